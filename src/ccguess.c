@@ -20,6 +20,7 @@
 #include "readkey.h"
 
 #define MAGIC "c051"   /* magic string for this version of leanocrypt */
+#define BATCH 8        /* number of headers passed to the cipher at once */
 #define NAME "ccguess" /* name of this program */
 #define CLEARLINE "\e[G\e[K"
 
@@ -45,41 +46,60 @@ int strcount(char *s, int c) {
 /* ---------------------------------------------------------------------- */
 /* from leanocryptlib.c */
 
-/* hash a keystring into a 256-bit cryptographic random value. */
-static void hashstring(char *keystring, xword32 hash[8]) {
-  int i;
-  roundkey rkk;
-  xword32 key[8];      /* rijndael key */
-
-  for (i=0; i<8; i++) 
-    key[i] = hash[i] = 0;
+/* hash m keystrings of the same length l into 256-bit cryptographic
+   random values, as hashstring does. The keystrings are stored
+   l+1 bytes apart. */
+static void hashstrings(char *keystrings, int m, int l, xword32 (*hash)[8]) {
+  int i, c, p;
+  roundkey rkk[BATCH];
+  roundkey *rkp[BATCH];
+  xword32 key[BATCH][8];      /* rijndael keys */
+
+  for (c=0; c<m; c++) {
+    for (i=0; i<8; i++) 
+      key[c][i] = hash[c][i] = 0;
+    rkp[c] = &rkk[c];
+  }
   
+  p = 0;
   do {
-    for (i=0; i<32; i++) {
-      if (*keystring != 0) {
-	((xword8 *)key)[i] ^= *keystring;
-	keystring++;
+    for (c=0; c<m; c++) {
+      for (i=0; i<32 && p+i<l; i++) {
+	((xword8 *)key[c])[i] ^= keystrings[c*(l+1)+p+i];
       }
     }
-    xrijndaelKeySched(key, 256, 256, &rkk);
-    xrijndaelEncrypt(hash, &rkk);
-  } while (*keystring != 0);
+    p += 32;
+    xrijndaelKeySched256n(key, m, rkk);
+    xrijndaelEncryptBlocks(hash[0], m, rkp, 1);
+    /* the next part of the keystring is added to the end of the
+       expanded key, as with xrijndaelKeySched */
+    for (c=0; c<m; c++) {
+      memcpy(key[c], rkk[c].rk + 112, 32);
+    }
+  } while (p < l);
 }
 
 /* ---------------------------------------------------------------------- */
 /* key testing */
 
-/* try the key on the given header. Return 1 if it matches, else 0. */
-int try_key(roundkey *rkk, xword32 header[8]) {
-  xword32 headercopy[8];
-  
-  memcpy(headercopy, header, 32);
-  xrijndaelDecrypt(headercopy, rkk);
-  if (strncmp((char *)headercopy, MAGIC, 4) != 0) {
-    return 0;
-  } else {
-    return 1;
+/* try the key on the n given headers. Return the number of headers
+   that match. */
+int try_key(roundkey *rkk, xword32 (*headers)[8], int n) {
+  xword32 headercopy[8*BATCH];
+  int i, j, m;
+  int matches = 0;
+
+  for (i=0; i<n; i+=m) {
+    m = n-i < BATCH ? n-i : BATCH;
+    memcpy(headercopy, headers[i], 32*m);
+    xrijndaelDecryptBlocks(headercopy, m, &rkk, 0);
+    for (j=0; j<m; j++) {
+      if (strncmp((char *)(headercopy+8*j), MAGIC, 4) == 0) {
+	matches++;
+      }
+    }
   }
+  return matches;
 }
 
 /* ---------------------------------------------------------------------- */
@@ -292,11 +312,11 @@ int tryall(pattern_t *plist, int wildcard, char *chartable, int ctsize, xword32
   pattern_t *pat;
   pattern_t *elt;
   pattern_t *matchlist = NULL;  /* do avoid duplicates */
-  int i, j;
+  int i, j, c, nc;
   int matches;
   int count = 0;
-  xword32 keyblock[8];
-  roundkey rkk;
+  xword32 keyblocks[BATCH][8];
+  roundkey rkks[BATCH];
 
   list_forall(pat, plist) {
     int w = pat->w;
@@ -304,6 +324,7 @@ int tryall(pattern_t *plist, int wildcard, char *chartable, int ctsize, xword32
     int alpha[w];
     char *s = strdup(pat->s);
     int l = pat->l;
+    char cand[BATCH*(l+1)];
         
     fprintf(stderr, ""CLEARLINE"%s %llu", s, global_count);
     fflush(stderr);
@@ -322,47 +343,58 @@ int tryall(pattern_t *plist, int wildcard, char *chartable, int ctsize, xword32
       alpha[i] = 0;
       s[index[i]] = chartable[0];
     }
+    /* candidates are collected and hashed in batches */
+    nc = 0;
     while (1) {
-      global_count++;
-      matches = 0;
-      for (i=0; i<n; i++) {
-	hashstring(s, keyblock);
-	xrijndaelKeySched(keyblock, 256, 256, &rkk);
-	if (try_key(&rkk, headers[i])) {
-	  matches++;
-	}
-      }
-      if (matches > 0) {
-	list_find(elt, matchlist, strcmp(elt->s, s)==0);
-	if (!elt) {
-	  count++;
-	  fprintf(stderr, ""CLEARLINE"");
-	  fflush(stderr);
-	  printf("\n");
-	  printf("Possible match: %s (%d change%s, found after trying %llu key%s)\n", s, pat->m, pat->m==1?"":"s", global_count, global_count==1?"":"s");
-	  if (matches < n) {
-	    printf("Warning: key only matches %d of %d files.\n", matches, n);
-	  }
-	  fflush(stdout);
-	  elt = pattern_new(s, wildcard, pat->m, pat->p);
-	  list_append(pattern_t, matchlist, elt);
-	  if (matches == n && !cont) {
-	    return count;
-	  }
-	}
-      }
-      
+      memcpy(cand+nc*(l+1), s, l+1);
+      nc++;
+
       i = w-1;
       while (i>=0 && alpha[i] >= ctsize-1) {
         alpha[i]=0;
         s[index[i]] = chartable[0];
 	i--;
       }
+      if (i>=0) {
+	alpha[i]++;
+	s[index[i]] = chartable[alpha[i]];
+      }
+      if (nc < BATCH && i>=0) {
+	continue;
+      }
+
+      hashstrings(cand, nc, l, keyblocks);
+      xrijndaelKeySched256n(keyblocks, nc, rkks);
+      for (c=0; c<nc; c++) {
+	char *t = cand+c*(l+1);
+
+	global_count++;
+	matches = try_key(&rkks[c], headers, n);
+	if (matches > 0) {
+	  list_find(elt, matchlist, strcmp(elt->s, t)==0);
+	  if (!elt) {
+	    count++;
+	    fprintf(stderr, ""CLEARLINE"");
+	    fflush(stderr);
+	    printf("\n");
+	    printf("Possible match: %s (%d change%s, found after trying %llu key%s)\n", t, pat->m, pat->m==1?"":"s", global_count, global_count==1?"":"s");
+	    if (matches < n) {
+	      printf("Warning: key only matches %d of %d files.\n", matches, n);
+	    }
+	    fflush(stdout);
+	    elt = pattern_new(t, wildcard, pat->m, pat->p);
+	    list_append(pattern_t, matchlist, elt);
+	    if (matches == n && !cont) {
+	      return count;
+	    }
+	  }
+	}
+      }
+      nc = 0;
+
       if (i<0) {
 	break;
       }
-      alpha[i]++;
-      s[index[i]] = chartable[alpha[i]];
     }
     free(s);
   }
@@ -396,6 +428,7 @@ int ccguess(char *key, xword32 (*headers)[8], int n, char *chartable, int ctsize
     }
   }
 
+  fprintf(stderr, "Using %s cipher kernel.\n", xrijndaelKernel());
   fprintf(stderr, "Generating patterns...");
   fflush(stderr);
   plist = pattern_new(key, wildcard, 0, 0);
@@ -451,6 +484,7 @@ static void usage(FILE *fout) {
 static void version(FILE *fout) {
   fprintf(fout, ""NAME" "VERSION". Search for leanocrypt encryption keys.\n");
   fprintf(fout, "Copyright (C) 2022 Komeil Majidi.\n");
+  fprintf(fout, "Cipher kernel: %s\n", xrijndaelKernel());
 }
 
 static void license(FILE *fout) {
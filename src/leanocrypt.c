@@ -12,7 +12,6 @@
 #include <sys/types.h>
 #include <unistd.h>
 
-#include "main.h"
 #include "leanocryptlib.h"
 #include "unixcryptlib.h"
 #include "platform.h"
@@ -55,6 +54,12 @@ const char *leanocrypt_error(int st) {
     case leanocrypt_EBUFFER:
       return _("buffer overflow");
       break;
+    case leanocrypt_ENOSLOT:
+      return _("no free key slot");
+      break;
+    case leanocrypt_EWRAPPED:
+      return _("file has key slots; use --wrapped to change its key");
+      break;
     default:
       /* do nothing */
       break;
@@ -65,45 +70,79 @@ const char *leanocrypt_error(int st) {
 
 /* ---------------------------------------------------------------------- */
 
-/* leanodencrypt_init_r is a variant of leanodencrypt_init that works around
-   bug #1872759. An unlucky combination of a past version of leanocrypt,
+/* leanocrypt_keyring_new_r makes the precomputed key used for both
+   encryption and decryption of the n keys in keys. It works around bug
+   #1872759. An unlucky combination of a past version of leanocrypt,
    cygwin, and windows accidentally read the key file in binary mode,
-   resulting in '\r' to be appended to the end of the key string.
-   While the current version of xreadline() strips '\r' from the end
-   of keys read from a file, we must still support decryption of these
-   legacy files for backward compatibility. To this end,
-   leanodencrypt_init_r registers two alternate keys: "key" and "key\r".
-   The first matching one is used. */
-
-static int leanodencrypt_init_r(leanocrypt_stream_t *b, const char *key, int flags) {
+   resulting in '\r' to be appended to the end of the key string. While
+   the current version of xreadline() strips '\r' from the end of keys
+   read from a file, we must still support decryption of these legacy
+   files for backward compatibility. To this end, each key "key" is
+   registered with an alternate key "key\r". The first matching one is
+   used for decryption; encryption always uses the first key.
+   leanocrypt_key_new_r does this for a single key. Returns NULL with
+   errno set on error. */
+
+leanocrypt_key_t *leanocrypt_keyring_new_r(int n, const char **keys) {
+  leanocrypt_key_t *k = NULL;
+  const char **keylist;
   char *key2;
-  const char *keylist[2];
-  int len = strlen(key);
-  int r;
+  int i, len;
 
-  key2 = (char *)malloc(len+2);
-  if (!key2) {
-    return -1;
+  keylist = (const char **)calloc(2*n, sizeof(char *));
+  if (!keylist) {
+    return NULL;
   }
-  strcpy(key2, key);
-  key2[len] = '\r';
-  key2[len+1] = 0;
+  for (i=0; i<n; i++) {
+    len = strlen(keys[i]);
+    key2 = (char *)malloc(len+2);
+    if (!key2) {
+      goto done;
+    }
+    strcpy(key2, keys[i]);
+    key2[len] = '\r';
+    key2[len+1] = 0;
 
-  keylist[0] = key;
-  keylist[1] = key2;
-  r = leanodencrypt_multi_init(b, 2, keylist, flags);
-  free(key2);
-  return r;
+    keylist[2*i] = keys[i];
+    keylist[2*i+1] = key2;
+  }
+  k = leanocrypt_key_new(2*n, keylist);
+
+ done:
+  for (i=0; i<n; i++) {
+    free((char *)keylist[2*i+1]);
+  }
+  free(keylist);
+  return k;
+}
+
+leanocrypt_key_t *leanocrypt_key_new_r(const char *key) {
+  return leanocrypt_keyring_new_r(1, &key);
 }
 
 
+/* ---------------------------------------------------------------------- */
+/* initialize an encryption stream in the format given by chunkshift,
+   nslots and keyid: wrapped if nslots is not 0, else chunked if
+   chunkshift is not 0, else serial; with a key identifier if keyid is
+   set and the format is not wrapped. */
+static int leanoencrypt_init_fmt(leanocrypt_stream_t *b, const leanocrypt_key_t *key, int chunkshift, int nslots, int keyid) {
+  if (nslots) {
+    return leanoencrypt_init_wrapped(b, &key, 1, nslots, chunkshift);
+  } else if (keyid) {
+    return leanoencrypt_init_keyid(b, key, chunkshift);
+  }
+  return leanoencrypt_init_chunked(b, key, chunkshift);
+}
+
 /* ---------------------------------------------------------------------- */
 /* keychange = compose decryption and encryption */
 
 struct keychange_state_s {
   leanocrypt_stream_t b1;
   leanocrypt_stream_t b2;
-  int iv;                /* count-down for IV bytes */
+  int iv;                /* input header not yet verified */
+  int wrapped;           /* output in the wrapped format */
   char buf[MIDBUFSIZE];
 };
 typedef struct keychange_state_s keychange_state_t;
@@ -114,7 +153,7 @@ static void keychange_state_free(keychange_state_t *st) {
   free(st);
 }
 
-static int keychange_init(leanocrypt_stream_t *b, const char *key1, const char *key2) {
+static int keychange_init(leanocrypt_stream_t *b, const leanocrypt_key_t *key1, const leanocrypt_key_t *key2, int chunkshift, int nslots, int keyid) {
   keychange_state_t *st;
   int r;
   int cerr, err;
@@ -127,17 +166,18 @@ static int keychange_init(leanocrypt_stream_t *b, const char *key1, const char *
   st->b1.state = NULL;
   st->b2.state = NULL;
 
-  r = leanodencrypt_init_r(&st->b1, key1, 0);
+  r = leanodencrypt_init_key(&st->b1, key1, 0);
   if (r) {
     goto error;
   }
-  r = leanoencrypt_init(&st->b2, key2);
+  r = leanoencrypt_init_fmt(&st->b2, key2, chunkshift, nslots, keyid);
   if (r) {
     goto error;
   }
   st->b2.next_in = &st->buf[0];
   st->b2.avail_in = 0;
-  st->iv = 32;  /* count down IV bytes */
+  st->iv = 1;
+  st->wrapped = nslots != 0;
 
   return 0;
 
@@ -156,9 +196,9 @@ static int keychange(leanocrypt_stream_t *b) {
   int r;
   int cerr, err;
 
-  /* note: we do not write anything until we have seen 32 bytes of
-     input. This way, we don't write the output IV until the input IV
-     has been verified. */
+  /* note: we do not write anything until the input header has been
+     verified. This way, we don't write the output IV until the input
+     key is known to match. */
 
   while (1) { 
     /* clear mid-buffer */
@@ -187,11 +227,15 @@ static int keychange(leanocrypt_stream_t *b) {
     if (r) {
       goto error;
     }
-    if (st->iv) {
-      st->iv -= b->avail_in - st->b1.avail_in;
-      if (st->iv <= 0) {
-	st->iv = 0;
+    if (st->iv && leanodencrypt_verified(&st->b1)) {
+      /* the other recipients' slots cannot be carried over, so only
+	 replace a wrapped file by a wrapped one when asked to */
+      if (leanodencrypt_slots(&st->b1) && !st->wrapped) {
+	leanocrypt_errno = leanocrypt_EWRAPPED;
+	r = -2;
+	goto error;
       }
+      st->iv = 0;
     }
     b->next_in = st->b1.next_in;
     b->avail_in = st->b1.avail_in;
@@ -247,16 +291,46 @@ typedef int initfun(leanocrypt_stream_t *b, const char *key);
 typedef int workfun(leanocrypt_stream_t *b);
 typedef int endfun(leanocrypt_stream_t *b);
 
-/* apply leanocrypt_stream to pipe stuff from fin to fout. Assume the
-   leanocrypt_stream has already been initialized. */
-static int streamhandler(leanocrypt_stream_t *b, workfun *work, endfun *end, 
-			 FILE *fin, FILE *fout) {
-  /* maybe should align buffers on page boundary */
-  char inbuf[INBUFSIZE], outbuf[OUTBUFSIZE]; 
+/* the number of threads for parallel encryption and decryption: one
+   per processor */
+static int nthreads(void) {
+  static int n = 0;
+
+  if (n == 0) {
+#ifdef _SC_NPROCESSORS_ONLN
+    n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    if (n < 1) {
+      n = 1;
+    }
+  }
+  return n;
+}
+
+/* work functions using all threads */
+static int leanoencrypt_par(leanocrypt_stream_t *b) {
+  return leanoencrypt_parallel(b, nthreads());
+}
+
+static int leanodencrypt_par(leanocrypt_stream_t *b) {
+  return leanodencrypt_parallel(b, nthreads());
+}
+
+/* the buffers of the parallel handlers hold PARBUFSIZE per thread,
+   which is a chunk of the default size, and enough for a decryption
+   thread */
+#define PARBUFSIZE ((size_t)1 << leanocrypt_CHUNKSHIFT)
+
+/* apply leanocrypt_stream to pipe stuff from fin to fout, through the
+   given buffers. Assume the leanocrypt_stream has already been
+   initialized. */
+static int streamhandler_buf(leanocrypt_stream_t *b, workfun *work, endfun *end, 
+			     FILE *fin, FILE *fout, char *inbuf, size_t insize,
+			     char *outbuf, size_t outsize) {
   int eof = 0;
   int r;
   int cerr, err;
-  int n;
+  size_t n;
 
   clearerr(fin);
 
@@ -265,10 +339,10 @@ static int streamhandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
   while (1) {
     /* fill input buffer */
     if (b->avail_in == 0 && !eof) {
-      r = fread(inbuf, 1, INBUFSIZE, fin);
+      n = fread(inbuf, 1, insize, fin);
       b->next_in = &inbuf[0];
-      b->avail_in = r;
-      if (r<INBUFSIZE) {
+      b->avail_in = n;
+      if (n<insize) {
 	eof = 1;
       }
       if (ferror(fin)) {
@@ -278,7 +352,7 @@ static int streamhandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
     }
     /* prepare output buffer */
     b->next_out = &outbuf[0];
-    b->avail_out = OUTBUFSIZE;
+    b->avail_out = outsize;
 
     /* do some work */
     r = work(b);
@@ -286,10 +360,9 @@ static int streamhandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
       return r;
     }
     /* process output buffer */
-    if (b->avail_out < OUTBUFSIZE) {
-      n = OUTBUFSIZE - b->avail_out;
-      r = fwrite(outbuf, 1, n, fout);
-      if (r < n) {
+    if (b->avail_out < outsize) {
+      n = outsize - b->avail_out;
+      if (fwrite(outbuf, 1, n, fout) < n) {
 	r = -3;
 	goto error;
       }
@@ -313,43 +386,74 @@ static int streamhandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
   return r;
 }  
 
-int leanoencrypt_streams(FILE *fin, FILE *fout, const char *key) {
+static int streamhandler(leanocrypt_stream_t *b, workfun *work, endfun *end, 
+			 FILE *fin, FILE *fout) {
+  /* maybe should align buffers on page boundary */
+  char inbuf[INBUFSIZE], outbuf[OUTBUFSIZE]; 
+
+  return streamhandler_buf(b, work, end, fin, fout, inbuf, INBUFSIZE, outbuf, OUTBUFSIZE);
+}
+
+/* as streamhandler, with buffers large enough for all threads */
+static int streamhandler_par(leanocrypt_stream_t *b, workfun *work, endfun *end, 
+			     FILE *fin, FILE *fout) {
+  size_t insize = nthreads() * PARBUFSIZE;
+  size_t outsize = insize + OUTBUFSIZE - INBUFSIZE;
+  char *inbuf, *outbuf;
+  int r;
+
+  inbuf = (char *)malloc(insize);
+  outbuf = (char *)malloc(outsize);
+  if (!inbuf || !outbuf) {
+    free(inbuf);
+    free(outbuf);
+    return streamhandler(b, work, end, fin, fout);
+  }
+  r = streamhandler_buf(b, work, end, fin, fout, inbuf, insize, outbuf, outsize);
+  free(inbuf);
+  free(outbuf);
+  return r;
+}
+
+int leanoencrypt_streams(FILE *fin, FILE *fout, const leanocrypt_key_t *key, int chunkshift, int nslots, int keyid) {
   leanocrypt_stream_t ccs;
   leanocrypt_stream_t *b = &ccs;
   int r;
 
-  r = leanoencrypt_init(b, key);
+  r = leanoencrypt_init_fmt(b, key, chunkshift, nslots, keyid);
   if (r) {
     return r;
   }
 
+  /* only the chunked format can be encrypted in parallel */
+  if (chunkshift && nthreads() > 1) {
+    return streamhandler_par(b, leanoencrypt_par, leanoencrypt_end, fin, fout);
+  }
   return streamhandler(b, leanoencrypt, leanoencrypt_end, fin, fout);
 }
 
-int leanodencrypt_streams(FILE *fin, FILE *fout, const char *key) {
+int leanodencrypt_streams(FILE *fin, FILE *fout, const leanocrypt_key_t *key, int flags) {
   leanocrypt_stream_t ccs;
   leanocrypt_stream_t *b = &ccs;
   int r;
-  int flags = 0;
-
-  if (cmd.mismatch) {
-    flags |= leanocrypt_MISMATCH;
-  }
 
-  r = leanodencrypt_init_r(b, key, flags);
+  r = leanodencrypt_init_key(b, key, flags);
   if (r) {
     return r;
   }
 
+  if (nthreads() > 1) {
+    return streamhandler_par(b, leanodencrypt_par, leanodencrypt_end, fin, fout);
+  }
   return streamhandler(b, leanodencrypt, leanodencrypt_end, fin, fout);
 }
 
-int cckeychange_streams(FILE *fin, FILE *fout, const char *key1, const char *key2) {
+int cckeychange_streams(FILE *fin, FILE *fout, const leanocrypt_key_t *key1, const leanocrypt_key_t *key2, int chunkshift, int nslots, int keyid) {
   leanocrypt_stream_t ccs;
   leanocrypt_stream_t *b = &ccs;
   int r;
 
-  r = keychange_init(b, key1, key2);
+  r = keychange_init(b, key1, key2, chunkshift, nslots, keyid);
   if (r) {
     return r;
   }
@@ -370,40 +474,224 @@ int unixcrypt_streams(FILE *fin, FILE *fout, const char *key) {
   return streamhandler(b, unixcrypt, unixcrypt_end, fin, fout);
 }
 
-/* check if the key matches the given file. This is done by decrypting
-   the first 32 bytes, ignoring the output. Return 0 on success, -1 on
-   error with errno set, -2 on error with leanocrypt_errno set. */
-int keycheck_stream(FILE *fin, const char *key) {
+#define RANGEBUFSIZE 65536
+
+/* as leanodencrypt_range, for an fd that cannot be read with pread,
+   such as a pipe: decrypt it from the start, and discard the bytes
+   before offset. b has been initialized. */
+static int range_stream(leanocrypt_stream_t *b, int fd, FILE *fout, off_t offset, off_t len) {
+  char inbuf[RANGEBUFSIZE], outbuf[RANGEBUFSIZE];
+  char *p;
+  ssize_t n;
+  size_t k;
+  int eof = 0;
+  int started = 0; /* has the header been read? */
+  int r;
+
+  b->avail_in = 0;
+  while (len != 0 || !started) {
+    if (b->avail_in == 0 && !eof) {
+      n = read(fd, inbuf, RANGEBUFSIZE);
+      if (n < 0 && errno == EINTR) {
+	continue;
+      } else if (n < 0) {
+	return -1;
+      } else if (n == 0) {
+	eof = 1;
+      }
+      b->next_in = inbuf;
+      b->avail_in = n;
+    }
+    b->next_out = outbuf;
+    b->avail_out = RANGEBUFSIZE;
+    r = leanodencrypt(b);
+    if (r) {
+      return r;
+    }
+    k = RANGEBUFSIZE - b->avail_out;
+    p = outbuf;
+    if (k > 0) {
+      started = 1;
+    }
+    if ((off_t)k <= offset) {
+      offset -= k;
+      k = 0;
+    } else {
+      p += offset;
+      k -= offset;
+      offset = 0;
+    }
+    if (len >= 0 && (off_t)k > len) {
+      k = len;
+    }
+    if (fwrite(p, 1, k, fout) < k) {
+      return -3;
+    }
+    if (len > 0) {
+      len -= k;
+    }
+    if (eof && b->avail_in == 0) {
+      break;
+    }
+  }
+  return 0;
+}
+
+/* decrypt len bytes at plaintext offset offset of the encrypted file
+   fd to fout, or up to the end of the file if len is negative. Only
+   the IV and the requested range are read, with pread; an fd that
+   cannot be read with pread, such as a pipe, is read up to the end of
+   the range. Return 0 on success, -1 on error with errno set, -2 on
+   error with leanocrypt_errno set, -3 on i/o error on fout. */
+int leanodencrypt_range(int fd, FILE *fout, const leanocrypt_key_t *key, int flags, off_t offset, off_t len) {
   leanocrypt_stream_t ccs;
   leanocrypt_stream_t *b = &ccs;
+  char buf[RANGEBUFSIZE];
+  ssize_t n;
+  size_t want;
+  int r;
+  int cerr, err;
+
+  r = leanodencrypt_init_key(b, key, flags);
+  if (r) {
+    return r;
+  }
+
+  if (lseek(fd, 0, SEEK_CUR) == -1 && errno == ESPIPE) {
+    r = range_stream(b, fd, fout, offset, len);
+    if (r) {
+      goto error;
+    }
+    return leanodencrypt_end(b);
+  }
+
+  /* check the key even if the range is empty */
+  r = leanodencrypt_pread(b, fd, buf, 0, offset);
+  if (r) {
+    goto error;
+  }
+  while (len != 0) {
+    want = (len < 0 || len > RANGEBUFSIZE) ? RANGEBUFSIZE : len;
+    n = leanodencrypt_pread(b, fd, buf, want, offset);
+    if (n < 0) {
+      r = n;
+      goto error;
+    } else if (n == 0) {
+      break;
+    }
+    if (fwrite(buf, 1, n, fout) < (size_t)n) {
+      r = -3;
+      goto error;
+    }
+    offset += n;
+    if (len > 0) {
+      len -= n;
+    }
+  }
+  return leanodencrypt_end(b);
+
+ error:
+  err = errno;
+  cerr = leanocrypt_errno;
+  leanodencrypt_end(b);
+  errno = err;
+  leanocrypt_errno = cerr;
+  return r;
+}
+
+/* encrypt fin onto the end of the encrypted file fd, which must match
+   key, continuing its stream. Only the header and the last block of fd
+   are read. Return 0 on success, -1 on error with errno set, -2 on
+   error with leanocrypt_errno set, -3 on i/o error. */
+int leanoencrypt_append(int fd, FILE *fin, const leanocrypt_key_t *key) {
+  leanocrypt_stream_t ccs;
+  leanocrypt_stream_t *b = &ccs;
+  char inbuf[INBUFSIZE], outbuf[OUTBUFSIZE];
+  char *p;
+  size_t n;
+  ssize_t w;
   int r;
-  char inbuf[32];
-  char outbuf[32];
   int cerr, err;
 
   clearerr(fin);
 
-  r = leanodencrypt_init_r(b, key, 0);
+  r = leanoencrypt_resume(b, fd, key);
   if (r) {
     return r;
   }
 
-  /* fill input buffer */
-  r = fread(inbuf, 1, 32, fin);
+  while ((n = fread(inbuf, 1, INBUFSIZE, fin)) > 0) {
+    b->next_in = &inbuf[0];
+    b->avail_in = n;
+    b->next_out = &outbuf[0];
+    b->avail_out = OUTBUFSIZE;
+    r = leanoencrypt(b);
+    if (r) {
+      goto error;
+    }
+    for (p = &outbuf[0]; p < b->next_out; p += w) {
+      w = write(fd, p, b->next_out - p);
+      if (w < 0 && errno == EINTR) {
+	w = 0;
+      } else if (w < 0) {
+	r = -3;
+	goto error;
+      }
+    }
+  }
   if (ferror(fin)) {
     r = -3;
     goto error;
   }
-  b->next_in = &inbuf[0];
-  b->avail_in = r;
-  b->next_out = &outbuf[0];
-  b->avail_out = 32;
-  
-  /* try to decrypt */
-  r = leanodencrypt(b);
+  return leanoencrypt_end(b);
+
+ error:
+  err = errno;
+  cerr = leanocrypt_errno;
+  leanoencrypt_end(b);
+  errno = err;
+  leanocrypt_errno = cerr;
+  return r;
+}
+
+/* check if the key matches the given file. This is done by decrypting
+   the header, ignoring the output. Return 0 on success, -1 on
+   error with errno set, -2 on error with leanocrypt_errno set. */
+int keycheck_stream(FILE *fin, const leanocrypt_key_t *key) {
+  leanocrypt_stream_t ccs;
+  leanocrypt_stream_t *b = &ccs;
+  int r;
+  char inbuf[32];
+  char outbuf[32];
+  int cerr, err;
+
+  clearerr(fin);
+
+  r = leanodencrypt_init_key(b, key, 0);
   if (r) {
     return r;
   }
+
+  while (!leanodencrypt_verified(b)) {
+    /* fill input buffer */
+    r = fread(inbuf, 1, 32, fin);
+    if (ferror(fin)) {
+      r = -3;
+      goto error;
+    } else if (r == 0) {
+      break;
+    }
+    b->next_in = &inbuf[0];
+    b->avail_in = r;
+    b->next_out = &outbuf[0];
+    b->avail_out = 32;
+
+    /* try to decrypt */
+    r = leanodencrypt(b);
+    if (r) {
+      return r;
+    }
+  }
   r = leanodencrypt_end(b);
   if (r) {
     return r;
@@ -425,30 +713,31 @@ int keycheck_stream(FILE *fin, const char *key) {
 /* A large value of FILEINBUFSIZE keeps the cost of "lseek" down. It
    is okay for FILEINBUFSIZE to be much larger than MIDBUFSIZE.
    FILEOUTBUFSIZE must be large enough to hold the encryption of
-   FILEINBUFSIZE in one piece, or otherwise there will be a buffer
-   overflow error. */
+   FILEINBUFSIZE in one piece, with the largest header (that of the
+   wrapped format), or otherwise there will be a buffer overflow
+   error. */
 
 #define FILEINBUFSIZE 10240
-#define FILEOUTBUFSIZE (FILEINBUFSIZE+32)
+#define FILEOUTBUFSIZE (FILEINBUFSIZE + 64*leanocrypt_MAXSLOTS + 96)
 
 /* apply leanocrypt_stream to destructively update (and resize) the given
    fd, which must be opened in read/write mode and seekable.
    Encryption will begin at the current file position (normally 0),
    and extend until the end of the file. Note: this only works if the
    stream encoder b/work/end expands its input by at most
-   FILEINBUFSIZE bytes; otherwise there will be a buffer overflow
+   outsize-insize bytes; otherwise there will be a buffer overflow
    error. */
 
-static int filehandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
-		       int fd) {
+static int filehandler_buf(leanocrypt_stream_t *b, workfun *work, endfun *end,
+			   int fd, char *inbuf, size_t insize,
+			   char *outbuf, size_t outsize) {
   /* rp = reader's position, wp = writer's position, fp = file position */
-  int p;      /* rp-wp */
-  char inbuf[FILEINBUFSIZE];
-  char outbuf[FILEINBUFSIZE+32];
-  int inbufsize, outbufsize;
+  off_t p;    /* rp-wp */
+  size_t inbufsize, outbufsize;
   off_t offs;
   int r;
-  int i;
+  size_t i;
+  ssize_t n;
   int eof=0;
   int err, cerr;
 
@@ -458,8 +747,7 @@ static int filehandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
   while (1) {
     /* file is at position wp */
     if (p != 0) {
-      r = lseek(fd, p, SEEK_CUR);
-      if (r == -1) {
+      if (lseek(fd, p, SEEK_CUR) == -1) {
 	r = -3;
 	goto error;
       }
@@ -468,23 +756,22 @@ static int filehandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
 
     /* read block */
     i = 0;
-    while (i<FILEINBUFSIZE && !eof) {
-      r = read(fd, inbuf+i, FILEINBUFSIZE-i);
-      if (r == -1) {
+    while (i<insize && !eof) {
+      n = read(fd, inbuf+i, insize-i);
+      if (n == -1) {
 	r = -3;
 	goto error;
-      } else if (r==0) {
+      } else if (n==0) {
 	eof = 1;
       }
-      i += r;
+      i += n;
     }
     p += i;
     inbufsize = i;
 
     /* file is at position rp */
     if (p != 0) {
-      r = lseek(fd, -p, SEEK_CUR);
-      if (r == -1) {
+      if (lseek(fd, -p, SEEK_CUR) == -1) {
 	r = -3;
 	goto error;
       }
@@ -492,7 +779,7 @@ static int filehandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
     /* file is at position wp */
 
     /* write previous block */
-    if (outbufsize > p && !eof) {
+    if ((off_t)outbufsize > p && !eof) {
       leanocrypt_errno = leanocrypt_EBUFFER; /* buffer overflow; should never happen */
       r = -2;
       goto error;
@@ -500,12 +787,12 @@ static int filehandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
     if (outbufsize != 0) {
       i = 0;
       while (i<outbufsize) {
-	r = write(fd, outbuf+i, outbufsize-i);
-	if (r == -1) {
+	n = write(fd, outbuf+i, outbufsize-i);
+	if (n == -1) {
 	  r = -3;
 	  goto error;
 	}
-	i += r;
+	i += n;
       }
       p -= outbufsize;
       outbufsize = 0;
@@ -515,7 +802,7 @@ static int filehandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
     b->next_in = inbuf;
     b->avail_in = inbufsize;
     b->next_out = outbuf;
-    b->avail_out = FILEINBUFSIZE+32;
+    b->avail_out = outsize;
 
     r = work(b);
     if (r) {
@@ -528,7 +815,7 @@ static int filehandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
       goto error;
     }
     inbufsize = 0;
-    outbufsize = FILEINBUFSIZE+32-b->avail_out;
+    outbufsize = outsize-b->avail_out;
 
     if (eof && outbufsize == 0) { /* done */
       break;
@@ -544,12 +831,11 @@ static int filehandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
   }
 
   /* truncate the file to where it's been written */
-  r = offs = lseek(fd, 0, SEEK_CUR);
-  if (r == -1) {
+  offs = lseek(fd, 0, SEEK_CUR);
+  if (offs == -1) {
     return -1;
   }
-  r = ftruncate(fd, offs);
-  if (r == -1) {
+  if (ftruncate(fd, offs) == -1) {
     return -1;
   }
   
@@ -564,38 +850,82 @@ static int filehandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
   return r;
 }
 
-int leanoencrypt_file(int fd, const char *key) {
+static int filehandler(leanocrypt_stream_t *b, workfun *work, endfun *end,
+		       int fd) {
+  char inbuf[FILEINBUFSIZE];
+  char outbuf[FILEOUTBUFSIZE];
+
+  return filehandler_buf(b, work, end, fd, inbuf, FILEINBUFSIZE, outbuf, FILEOUTBUFSIZE);
+}
+
+/* as filehandler, with buffers large enough for all threads */
+static int filehandler_par(leanocrypt_stream_t *b, workfun *work, endfun *end,
+			   int fd) {
+  size_t insize = nthreads() * PARBUFSIZE;
+  size_t outsize = insize + FILEOUTBUFSIZE - FILEINBUFSIZE;
+  char *inbuf, *outbuf;
+  int r;
+
+  inbuf = (char *)malloc(insize);
+  outbuf = (char *)malloc(outsize);
+  if (!inbuf || !outbuf) {
+    free(inbuf);
+    free(outbuf);
+    return filehandler(b, work, end, fd);
+  }
+  r = filehandler_buf(b, work, end, fd, inbuf, insize, outbuf, outsize);
+  free(inbuf);
+  free(outbuf);
+  return r;
+}
+
+int leanoencrypt_file(int fd, const leanocrypt_key_t *key, int chunkshift, int nslots, int keyid) {
   leanocrypt_stream_t ccs;
   leanocrypt_stream_t *b = &ccs;
   int r;
 
-  r = leanoencrypt_init(b, key);
+  r = leanoencrypt_init_fmt(b, key, chunkshift, nslots, keyid);
   if (r) {
     return r;
   }
 
+  if (chunkshift && nthreads() > 1) {
+    return filehandler_par(b, leanoencrypt_par, leanoencrypt_end, fd);
+  }
   return filehandler(b, leanoencrypt, leanoencrypt_end, fd);
 }
 
-int leanodencrypt_file(int fd, const char *key) {
+int leanodencrypt_file(int fd, const leanocrypt_key_t *key) {
   leanocrypt_stream_t ccs;
   leanocrypt_stream_t *b = &ccs;
   int r;
 
-  r = leanodencrypt_init_r(b, key, 0);
+  r = leanodencrypt_init_key(b, key, 0);
   if (r) {
     return r;
   }
 
+  if (nthreads() > 1) {
+    return filehandler_par(b, leanodencrypt_par, leanodencrypt_end, fd);
+  }
   return filehandler(b, leanodencrypt, leanodencrypt_end, fd);
 }
 
-int cckeychange_file(int fd, const char *key1, const char *key2) {
+/* change the key of the file fd from key1 to key2. A file in the
+   wrapped format is changed in place by rewriting its key slot; other
+   files are re-encrypted in the format given by chunkshift, nslots
+   and keyid. */
+int cckeychange_file(int fd, const leanocrypt_key_t *key1, const leanocrypt_key_t *key2, int chunkshift, int nslots, int keyid) {
   leanocrypt_stream_t ccs;
   leanocrypt_stream_t *b = &ccs;
   int r;
 
-  r = keychange_init(b, key1, key2);
+  r = leanocrypt_rewrap(fd, key1, key2, 0);
+  if (r != -2 || leanocrypt_errno != leanocrypt_EFORMAT) {
+    return r;
+  }
+
+  r = keychange_init(b, key1, key2, chunkshift, nslots, keyid);
   if (r) {
     return r;
   }
@@ -603,6 +933,12 @@ int cckeychange_file(int fd, const char *key1, const char *key2) {
   return filehandler(b, keychange, keychange_end, fd);
 }
 
+/* add key2 to the file fd in the wrapped format, which must match
+   key1, without changing its other keys or its data. */
+int cckeyadd_file(int fd, const leanocrypt_key_t *key1, const leanocrypt_key_t *key2) {
+  return leanocrypt_rewrap(fd, key1, key2, leanocrypt_ADDKEY);
+}
+
 int unixcrypt_file(int fd, const char *key) {
   leanocrypt_stream_t ccs;
   leanocrypt_stream_t *b = &ccs;
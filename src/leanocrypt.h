@@ -8,14 +8,19 @@
 #include "leanocryptlib.h"
 
 const char *leanocrypt_error(int st);
+leanocrypt_key_t *leanocrypt_key_new_r(const char *key);
+leanocrypt_key_t *leanocrypt_keyring_new_r(int n, const char **keys);
 
-int leanoencrypt_streams(FILE *fin, FILE *fout, const char *key);
-int leanodencrypt_streams(FILE *fin, FILE *fout, const char *key);
-int cckeychange_streams(FILE *fin, FILE *fout, const char *key1, const char *key2);
+int leanoencrypt_streams(FILE *fin, FILE *fout, const leanocrypt_key_t *key, int chunkshift, int nslots, int keyid);
+int leanodencrypt_streams(FILE *fin, FILE *fout, const leanocrypt_key_t *key, int flags);
+int cckeychange_streams(FILE *fin, FILE *fout, const leanocrypt_key_t *key1, const leanocrypt_key_t *key2, int chunkshift, int nslots, int keyid);
 int unixcrypt_streams(FILE *fin, FILE *fout, const char *key);
-int keycheck_stream(FILE *fin, const char *key);
+int keycheck_stream(FILE *fin, const leanocrypt_key_t *key);
+int leanodencrypt_range(int fd, FILE *fout, const leanocrypt_key_t *key, int flags, off_t offset, off_t len);
+int leanoencrypt_append(int fd, FILE *fin, const leanocrypt_key_t *key);
 
-int leanoencrypt_file(int fd, const char *key);
-int leanodencrypt_file(int fd, const char *key);
-int cckeychange_file(int fd, const char *key1, const char *key2);
+int leanoencrypt_file(int fd, const leanocrypt_key_t *key, int chunkshift, int nslots, int keyid);
+int leanodencrypt_file(int fd, const leanocrypt_key_t *key);
+int cckeychange_file(int fd, const leanocrypt_key_t *key1, const leanocrypt_key_t *key2, int chunkshift, int nslots, int keyid);
+int cckeyadd_file(int fd, const leanocrypt_key_t *key1, const leanocrypt_key_t *key2);
 int unixcrypt_file(int fd, const char *key);
@@ -2,17 +2,31 @@
 
 #include <stdlib.h>
 #include <unistd.h>
+#include <errno.h>
 #include <sys/time.h>
 #include <stdio.h>
 #include <string.h>
 #ifdef HAVE_CONFIG_H
 #include <config.h>  /* generated by configure */
 #endif
+#ifdef HAVE_LIBPTHREAD
+#include <pthread.h>
+#endif
+#ifdef HAVE_SYS_RANDOM_H
+#include <sys/random.h>
+#endif
 #include "leanocryptlib.h"
 #include "rijndael.h"
 #include "platform.h"
 
 #define MAGIC "c051"   /* magic string for this version of leanocrypt */
+#define MAGICCHUNKED "c052" /* magic string for the chunked format */
+#define MAGICWRAPPED "c053" /* magic string for key slots */
+#define MAGICKEYID "c054"   /* magic string for a key identifier */
+#define KEYIDSIZE 16   /* bytes in a key identifier */
+#define BATCH 8        /* number of blocks passed to the cipher at once */
+#define MINBLOCKS 8192 /* minimum number of blocks per thread */
+#define LANES 64       /* streams advanced together by leanoencrypt_lanes */
 
 /* private struct, not visible by applications */
 struct leanocrypt_state_s {  
@@ -23,16 +37,75 @@ struct leanocrypt_state_s {
   int bufindex;   /* in bytes */
   xword32 buf[8];  /* current buffer; partly ciphertext, partly mask */
   int flags;      /* flags determining behavior */
+  int external;   /* was the storage provided by the caller? */
+  int chunkshift; /* 0, or log2 of the chunk size in the chunked format */
+  xword32 nonce[8]; /* in the chunked format: the nonce, for chunk IVs */
+  xword64 pos;    /* plaintext bytes processed */
+  int hdr;        /* reading: the kind of the next header block, HDR_* */
+  int slot;       /* wrapped format: the key slot being read */
+  int nslots;     /* wrapped format: the number of key slots, or 0 */
+  unsigned int skip; /* reading: header bytes to skip */
+  xword64 hdrlen; /* header bytes read or written so far */
+  xword32 aux[8]; /* wrapped format: a slot's first block, then the data key */
+  char *hdrbuf;   /* writing: the header before the IV, or NULL */
+  unsigned int hdrsize; /* writing: the size of hdrbuf */
+  roundkey dk;    /* wrapped format: the data key */
+  struct leanocrypt_key_s *ring; /* reading: the shared keys, until one matches */
 };
 typedef struct leanocrypt_state_s leanocrypt_state_t;
 
-int leanocrypt_errno;
+#define HDR_IV      0  /* an IV, or the first block of a key slot */
+#define HDR_WRAPKEY 1  /* the second block of a matching key slot */
+#define HDR_DATAIV  2  /* the IV of the data, after the key slots */
+#define HDR_KEYIV   3  /* the IV, after a key identifier */
+
+/* the active key is stored in the same block, after the state */
+#define STATEHEAD ((sizeof(leanocrypt_state_t) + 15) & ~(size_t)15)
+
+/* a precomputed key: the expanded round keys of n passphrases */
+struct leanocrypt_key_s {
+  int n;          /* number of keys */
+  roundkey *rkks; /* array of n keys */
+  int refs;       /* the caller's, and one per stream matching a header */
+  xword8 (*ids)[KEYIDSIZE]; /* the key identifier of each key */
+  int *table;     /* hash table of the ids: 1 + the index of a key, or 0 */
+  unsigned int tmask; /* the size of table, minus 1 */
+};
+
+/* the error of the last failing call in this thread */
+#ifdef __GNUC__
+static __thread int leanocrypt_errno_value;
+#else
+static int leanocrypt_errno_value;
+#endif
+
+int *leanocrypt_errno_location(void) {
+  return &leanocrypt_errno_value;
+}
+
+int leanocrypt_version(void) {
+  return leanocrypt_VERSION;
+}
+
+/* record error e for stream b, and return -2 */
+static int leanocrypt_fail(leanocrypt_stream_t *b, int e) {
+  b->error = e;
+  leanocrypt_errno = e;
+  return -2;
+}
+
+static void key_release(leanocrypt_key_t *k);
 
 static void leanocrypt_state_free(leanocrypt_state_t *st) {
   if (st) {
-    free(st->rkks);
+    free(st->hdrbuf);
+  }
+  if (st && st->ring) {
+    key_release(st->ring);
+  }
+  if (st && !st->external) {
+    free(st);
   }
-  free(st);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -54,61 +127,613 @@ static void hashstring(const char *keystring, xword32 hash[8]) {
 	keystring++;
       }
     }
-    xrijndaelKeySched(key, 256, 256, &rkk);
+    xrijndaelKeySched256(key, &rkk);
     xrijndaelEncrypt(hash, &rkk);
+    /* the next part of the keystring is added to the end of the
+       expanded key, as with xrijndaelKeySched */
+    memcpy(key, rkk.rk + 112, 32);
   } while (*keystring != 0);
 }
 
-/* return a 256-bit value that is practically unique */
+/* Nonces are a counter encrypted under a random seed key. The seed is
+   drawn once per process, from getrandom() or /dev/urandom if
+   available, and again in a forked child, so that parent and child do
+   not repeat each other's nonces. */
+
+static roundkey nonce_rkk;     /* seed key */
+static xword32 nonce_ctr[8];   /* counter, starting at a random value */
+static pid_t nonce_pid = 0;    /* process that drew the seed, or 0 */
+#ifdef HAVE_LIBPTHREAD
+static pthread_mutex_t nonce_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void nonce_prepare(void) {
+  pthread_mutex_lock(&nonce_lock);
+}
+
+static void nonce_parent(void) {
+  pthread_mutex_unlock(&nonce_lock);
+}
+
+static void nonce_child(void) {
+  nonce_pid = 0;
+  pthread_mutex_unlock(&nonce_lock);
+}
+#endif
+
+/* fill seed with random bytes. If the system has no source of
+   randomness, fall back to hashing the host name, time, and pid. */
+static void nonce_seed(xword32 seed[16]) {
+  size_t got = 0;
+  FILE *f;
+  int err = errno;
+#ifdef HAVE_GETRANDOM
+  ssize_t r;
+
+  while (got < 64) {
+    r = getrandom((char *)seed + got, 64 - got, 0);
+    if (r < 0 && errno == EINTR) {
+      continue;
+    } else if (r <= 0) {
+      break;
+    }
+    got += r;
+  }
+#endif
+  if (got < 64) {
+    f = fopen("/dev/urandom", "rb");
+    if (f) {
+      got = fread(seed, 1, 64, f);
+      fclose(f);
+    }
+  }
+  if (got < 64) {
+    char acc[512], host[256];
+    struct timeval tv;
+
+    gethostname(host, 256);   /* ignore failures */
+    host[255] = 0;
+    gettimeofday(&tv, NULL);  /* ignore failures */
+    sprintf(acc, "%s,%ld,%ld,%ld", host, (long)tv.tv_sec, (long)tv.tv_usec,
+	    (long)getpid());
+    hashstring(acc, seed);
+    memset(seed + 8, 0, 32);
+  }
+  errno = err;
+}
+
 static void make_nonce(xword32 nonce[8]) {
-  char acc[512], host[256];
-  struct timeval tv;
-  static int count=0;
-  
-  gethostname(host, 256);   /* ignore failures */
-  host[255] = 0;
-  gettimeofday(&tv, NULL);  /* ignore failures */
-  sprintf(acc, "%s,%ld,%ld,%ld,%d", host, (long)tv.tv_sec, (long)tv.tv_usec,
-	  (long)getpid(), count++);
-  hashstring(acc, nonce); 
+  xword32 seed[16];
+  int i;
+
+#ifdef HAVE_LIBPTHREAD
+  pthread_mutex_lock(&nonce_lock);
+#endif
+  if (nonce_pid != getpid()) {
+#ifdef HAVE_LIBPTHREAD
+    static int registered = 0;
+
+    if (!registered) {
+      pthread_atfork(nonce_prepare, nonce_parent, nonce_child);
+      registered = 1;
+    }
+#endif
+    nonce_seed(seed);
+    xrijndaelKeySched256(seed, &nonce_rkk);
+    memcpy(nonce_ctr, seed + 8, 32);
+    memset(seed, 0, sizeof(seed));
+    nonce_pid = getpid();
+  }
+  for (i=0; i<8; i++) {
+    if (++nonce_ctr[i] != 0) {
+      break;
+    }
+  }
+  memcpy(nonce, nonce_ctr, 32);
+#ifdef HAVE_LIBPTHREAD
+  pthread_mutex_unlock(&nonce_lock);
+#endif
+
+  /* the seed key is written only once per process, before any nonce
+     is handed out, so it can be read without the lock */
+  xrijndaelEncrypt(nonce, &nonce_rkk);
 }
 
 /* ---------------------------------------------------------------------- */
-/* core functions for encryption */
+/* precomputed keys */
 
-int leanoencrypt_init(leanocrypt_stream_t *b, const char *key) {
-  xword32 keyblock[8];
-  leanocrypt_state_t *st;
-  roundkey *rkks;
+/* The key identifier of a key is the start of the encryption of a
+   constant block. Like the IV, it only allows to test guesses of the
+   key, but it tells which files share a key. A header block carrying
+   it lets decryption find the key in a keyring by a hash lookup,
+   rather than by trying each key on the IV. */
 
-  b->state = NULL;
-  
-  st = (leanocrypt_state_t *)malloc(sizeof(leanocrypt_state_t));
-  if (st == NULL) {
+static unsigned int keyid_hash(const xword8 *id) {
+  return id[0] | id[1] << 8 | id[2] << 16 | (unsigned int)id[3] << 24;
+}
+
+/* compute the ids of the keys of k and their hash table. Return 0, or
+   -1 with errno set. */
+static int keyid_init(leanocrypt_key_t *k) {
+  xword32 (*blk)[8];
+  roundkey **rkp;
+  unsigned int size, h;
+  int i;
+
+  for (size=1; size < 2*(unsigned int)k->n; size <<= 1)
+    ;
+  k->ids = (xword8 (*)[KEYIDSIZE])malloc(k->n * KEYIDSIZE);
+  k->table = (int *)calloc(size, sizeof(int));
+  k->tmask = size - 1;
+  blk = (xword32 (*)[8])malloc(k->n * sizeof(xword32[8]));
+  rkp = (roundkey **)malloc(k->n * sizeof(roundkey *));
+  if (!k->ids || !k->table || !blk || !rkp) {
+    free(k->ids);
+    free(k->table);
+    free(blk);
+    free(rkp);
     return -1;
   }
-  rkks = (roundkey *)malloc(sizeof(roundkey));
-  if (!rkks) {
-    free(st);
+
+  for (i=0; i<k->n; i++) {
+    memset(blk[i], 0, 32);
+    strncpy((char *)blk[i], "leanocrypt key identifier", 32);
+    rkp[i] = &k->rkks[i];
+  }
+  xrijndaelEncryptBlocks(blk[0], k->n, rkp, 1);
+
+  /* insert in order, so that the first of equal keys is found */
+  for (i=0; i<k->n; i++) {
+    memcpy(k->ids[i], blk[i], KEYIDSIZE);
+    h = keyid_hash(k->ids[i]) & k->tmask;
+    while (k->table[h]) {
+      h = (h + 1) & k->tmask;
+    }
+    k->table[h] = i + 1;
+  }
+  free(blk);
+  free(rkp);
+  return 0;
+}
+
+/* return the index of the first key of k with identifier id, or -1 */
+static int keyid_lookup(const leanocrypt_key_t *k, const xword8 *id) {
+  unsigned int h = keyid_hash(id) & k->tmask;
+
+  while (k->table[h]) {
+    if (memcmp(k->ids[k->table[h] - 1], id, KEYIDSIZE) == 0) {
+      return k->table[h] - 1;
+    }
+    h = (h + 1) & k->tmask;
+  }
+  return -1;
+}
+
+/* write the header block carrying the identifier of the first key of k */
+static void keyid_write(const leanocrypt_key_t *k, char blk[32]) {
+  memset(blk, 0, 32);
+  strncpy(blk, MAGICKEYID, 4);
+  memcpy(blk + 32 - KEYIDSIZE, k->ids[0], KEYIDSIZE);
+}
+
+/* is blk a header block carrying a key identifier? */
+static int keyid_block(const char blk[32]) {
+  int i;
+
+  if (strncmp(blk, MAGICKEYID, 4) != 0) {
+    return 0;
+  }
+  for (i=4; i<32 - KEYIDSIZE; i++) {
+    if (blk[i] != 0) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+leanocrypt_key_t *leanocrypt_key_new(int n, const char **keylist) {
+  xword32 (*keyblocks)[8];
+  leanocrypt_key_t *k;
+  int i;
+
+  k = (leanocrypt_key_t *)malloc(sizeof(leanocrypt_key_t));
+  if (k == NULL) {
+    return NULL;
+  }
+  k->rkks = (roundkey *)malloc(n * sizeof(roundkey));
+  if (!k->rkks) {
+    free(k);
+    return NULL;
+  }
+
+  keyblocks = (xword32 (*)[8])malloc(n * sizeof(xword32[8]));
+  if (!keyblocks) {
+    free(k->rkks);
+    free(k);
+    return NULL;
+  }
+
+  /* generate the roundkeys */
+  for (i=0; i<n; i++) {
+    hashstring(keylist[i], keyblocks[i]);
+  }
+  xrijndaelKeySched256n(keyblocks, n, k->rkks);
+  memset(keyblocks, 0, n * sizeof(xword32[8]));
+  free(keyblocks);
+
+  k->n = n;
+  k->refs = 1;
+  if (keyid_init(k) != 0) {
+    memset(k->rkks, 0, n * sizeof(roundkey));
+    free(k->rkks);
+    free(k);
+    return NULL;
+  }
+  return k;
+}
+
+/* A decryption stream shares the keys of k while it matches the
+   header, which saves copying a large keyring for each stream, and
+   keeps a copy of the matching key only. k is freed when the caller
+   and all such streams are done with it. */
+static leanocrypt_key_t *key_hold(const leanocrypt_key_t *k) {
+  leanocrypt_key_t *kk = (leanocrypt_key_t *)k;
+
+#ifdef __GNUC__
+  __sync_fetch_and_add(&kk->refs, 1);
+#else
+  kk->refs++;
+#endif
+  return kk;
+}
+
+static void key_release(leanocrypt_key_t *k) {
+  int refs;
+
+#ifdef __GNUC__
+  refs = __sync_sub_and_fetch(&k->refs, 1);
+#else
+  refs = --k->refs;
+#endif
+  if (refs == 0) {
+    memset(k->rkks, 0, k->n * sizeof(roundkey));
+    free(k->rkks);
+    free(k->ids);
+    free(k->table);
+    free(k);
+  }
+}
+
+void leanocrypt_key_free(leanocrypt_key_t *k) {
+  if (k) {
+    key_release(k);
+  }
+}
+
+size_t leanocrypt_state_size(void) {
+  return STATEHEAD + sizeof(roundkey);
+}
+
+/* make a state in the size bytes at mem, or in a single new allocation
+   if mem is NULL. For encryption, it holds a copy of the first key of
+   k; for decryption, it shares the keys of k until one matches. Return
+   NULL if allocation fails, with errno set, or if size is too small. */
+static leanocrypt_state_t *leanocrypt_state_new(const leanocrypt_key_t *k, int decrypt, void *mem, size_t size) {
+  leanocrypt_state_t *st;
+
+  if (mem == NULL) {
+    st = (leanocrypt_state_t *)malloc(leanocrypt_state_size());
+    if (st == NULL) {
+      return NULL;
+    }
+    st->external = 0;
+  } else if (size < leanocrypt_state_size()) {
+    return NULL;
+  } else {
+    st = (leanocrypt_state_t *)mem;
+    st->external = 1;
+  }
+  if (decrypt) {
+    st->ring = key_hold(k);
+    st->rkks = k->rkks;
+    st->n = k->n;
+  } else {
+    st->ring = NULL;
+    st->rkks = (roundkey *)((char *)st + STATEHEAD);
+    memcpy(st->rkks, k->rkks, sizeof(roundkey));
+    st->n = 1;
+  }
+  st->ak = 0;
+  st->chunkshift = 0;
+  st->pos = 0;
+  st->hdr = HDR_IV;
+  st->slot = 0;
+  st->nslots = 0;
+  st->skip = 0;
+  st->hdrlen = 0;
+  st->hdrbuf = NULL;
+  st->hdrsize = 0;
+  return st;
+}
+
+/* return the index of the first of the n keys that decrypts iv to a
+   nonce with a "magic number", or -1 if there is none. The nonce is
+   stored in nonce. The IV is decrypted with up to BATCH keys at a
+   time. */
+static int match_key(roundkey *rkks, int n, const xword32 iv[8], int flags, xword32 nonce[8]) {
+  xword32 lbuf[8*BATCH];
+  roundkey *rkp[BATCH];
+  int i, j, m;
+
+  if ((flags & leanocrypt_MISMATCH) != 0) {
+    if (n == 0) {
+      return -1;
+    }
+    memcpy(nonce, iv, 32);
+    xrijndaelDecrypt(nonce, &rkks[0]);
+    return 0;
+  }
+  for (i=0; i<n; i+=m) {
+    m = n - i < BATCH ? n - i : BATCH;
+    for (j=0; j<m; j++) {
+      memcpy(lbuf+8*j, iv, 32);
+      rkp[j] = &rkks[i+j];
+    }
+    xrijndaelDecryptBlocks(lbuf, m, rkp, 1);
+    for (j=0; j<m; j++) {
+      if (strncmp((char *)(lbuf+8*j), MAGIC, 4) == 0
+	  || strncmp((char *)(lbuf+8*j), MAGICCHUNKED, 4) == 0
+	  || strncmp((char *)(lbuf+8*j), MAGICWRAPPED, 4) == 0) {
+	memcpy(nonce, lbuf+8*j, 32);
+	return i+j;
+      }
+    }
+  }
+  return -1;
+}
+
+/* ---------------------------------------------------------------------- */
+/* the chunked format */
+
+/* In the chunked format, the nonce carries the magic number
+   MAGICCHUNKED, and the log2 of the chunk size in byte 4. Each chunk
+   is CFB-encrypted on its own: chunk i starts from the encryption of
+   the nonce with i xored into its last 8 bytes. For chunk 0, this is
+   the IV, so that the first chunk is encrypted as in the serial
+   format. There is no per-chunk overhead: plaintext offset x is at
+   ciphertext offset x+32, and the chunk index is implicit. */
+
+/* set up st for the format of nonce. Return 0, or -1 if the chunk
+   size is out of range. */
+static int chunk_init(leanocrypt_state_t *st, const xword32 nonce[8]) {
+  int shift;
+
+  if (strncmp((char *)nonce, MAGICCHUNKED, 4) != 0) {
+    st->chunkshift = 0;
+    return 0;
+  }
+  shift = ((xword8 *)nonce)[4];
+  if (shift < leanocrypt_CHUNKSHIFTMIN || shift > leanocrypt_CHUNKSHIFTMAX) {
     return -1;
   }
+  st->chunkshift = shift;
+  memcpy(st->nonce, nonce, 32);
+  return 0;
+}
+
+static void chunk_iv(const leanocrypt_state_t *st, roundkey *rkk, xword64 i, xword32 prev[8]) {
+  int j;
+
+  memcpy(prev, st->nonce, 32);
+  for (j=0; j<8; j++) {
+    ((xword8 *)prev)[24+j] ^= (xword8)(i >> 8*j);
+  }
+  xrijndaelEncrypt(prev, rkk);
+}
+
+/* called after each plaintext byte or block: start the next chunk if
+   pos is at a chunk boundary */
+static void chunk_next(const leanocrypt_state_t *st, roundkey *rkk, xword64 pos, xword32 prev[8]) {
+  if (st->chunkshift && (pos & (((xword64)1 << st->chunkshift) - 1)) == 0) {
+    chunk_iv(st, rkk, pos >> st->chunkshift, prev);
+  }
+}
 
-  st->n = 1;
-  st->rkks = rkks;
-  st->ak = 0; /* not used */
+/* the number of whole blocks from pos to the end of its chunk, at
+   most nblocks */
+static size_t chunk_blocks(const leanocrypt_state_t *st, xword64 pos, size_t nblocks) {
+  xword64 chunk;
+  size_t m;
 
-  /* generate the roundkey */
-  hashstring(key, keyblock);
-  xrijndaelKeySched(keyblock, 256, 256, &st->rkks[0]);
-  
+  if (st->chunkshift == 0) {
+    return nblocks;
+  }
+  chunk = (xword64)1 << st->chunkshift;
+  m = (chunk - (pos & (chunk - 1))) / 32;
+  return m < nblocks ? m : nblocks;
+}
+
+/* ---------------------------------------------------------------------- */
+/* the wrapped format */
+
+/* In the wrapped format, the data is a stream in the serial or chunked
+   format under a random data key. It is preceded by a marker block,
+   nslots key slots of SLOTSIZE bytes and a 32-byte slot map. The
+   marker holds MAGICWRAPPED, nslots in byte 4, and zeros, in the
+   clear, so that a reader tries a key on further slots only in this
+   format, and only on nslots of them. A used slot is a short
+   stream of its own under a passphrase: an IV whose nonce carries the
+   magic number MAGICWRAPPED and, in byte 4, nslots, followed by the
+   encrypted data key. Unused slots are random. The slot map is the
+   encryption under the data key of a block whose first 4 bytes are the
+   mask of used slots, so that any recipient can add another. Changing
+   or adding a passphrase rewrites only a slot and the map. */
+
+#define SLOTSIZE 64
+#define SLOTOFFSET(i) (32 + SLOTSIZE*(xword64)(i))
+#define MAPOFFSET(nslots) SLOTOFFSET(nslots)
+
+/* write the marker block of the wrapped format */
+static void wrap_write(int nslots, char blk[32]) {
+  memset(blk, 0, 32);
+  strncpy(blk, MAGICWRAPPED, 4);
+  ((xword8 *)blk)[4] = nslots;
+}
+
+/* return nslots if blk is the marker block of the wrapped format, or
+   else 0 */
+static int wrap_block(const char blk[32]) {
+  int i, nslots;
+
+  if (strncmp(blk, MAGICWRAPPED, 4) != 0) {
+    return 0;
+  }
+  for (i=5; i<32; i++) {
+    if (blk[i] != 0) {
+      return 0;
+    }
+  }
+  nslots = ((const xword8 *)blk)[4];
+  return nslots <= leanocrypt_MAXSLOTS ? nslots : 0;
+}
+
+/* write a slot holding the data key dk under the key rkk */
+static void wrap_slot(roundkey *rkk, const xword32 dk[8], int nslots, char slot[SLOTSIZE]) {
+  xword32 iv[8], mask[8];
+  int i;
+
+  make_nonce(iv);
+  strncpy((char *)iv, MAGICWRAPPED, 4);
+  ((xword8 *)iv)[4] = nslots;
+  xrijndaelEncrypt(iv, rkk);
+  memcpy(mask, iv, 32);
+  xrijndaelEncrypt(mask, rkk);
+  for (i=0; i<8; i++) {
+    mask[i] ^= dk[i];
+  }
+  memcpy(slot, iv, 32);
+  memcpy(slot+32, mask, 32);
+  memset(mask, 0, 32);
+}
+
+/* recover the data key dk from the two blocks iv, key of a slot */
+static void unwrap_slot(roundkey *rkk, const xword32 iv[8], const xword32 key[8], xword32 dk[8]) {
+  xword32 mask[8];
+  int i;
+
+  memcpy(mask, iv, 32);
+  xrijndaelEncrypt(mask, rkk);
+  for (i=0; i<8; i++) {
+    dk[i] = mask[i] ^ key[i];
+  }
+  memset(mask, 0, 32);
+}
+
+/* write the slot map for the mask of used slots under the data key */
+static void map_write(roundkey *dkrk, xword32 used, char map[32]) {
+  xword32 blk[8];
+  int i;
+
+  make_nonce(blk);
+  for (i=0; i<4; i++) {
+    ((xword8 *)blk)[i] = (xword8)(used >> 8*i);
+  }
+  xrijndaelEncrypt(blk, dkrk);
+  memcpy(map, blk, 32);
+}
+
+/* return the mask of used slots from the slot map */
+static xword32 map_read(roundkey *dkrk, const char map[32]) {
+  xword32 blk[8];
+  xword32 used = 0;
+  int i;
+
+  memcpy(blk, map, 32);
+  xrijndaelDecrypt(blk, dkrk);
+  for (i=0; i<4; i++) {
+    used |= (xword32)((xword8 *)blk)[i] << 8*i;
+  }
+  return used;
+}
+
+/* ---------------------------------------------------------------------- */
+/* core functions for encryption */
+
+/* CFB-encrypt nblocks whole blocks from in to out, which may be equal.
+   prev holds the ciphertext block preceding in; on return it holds the
+   last ciphertext block. The 8-byte copies compile to single loads and
+   stores, aligned or not. */
+static void cfb_encrypt_blocks(roundkey *rkk, xword32 prev[8], const char *in, char *out, size_t nblocks) {
+  xword64 c8, m8;
+  int i;
+
+  while (nblocks > 0) {
+    xrijndaelEncrypt(prev, rkk);
+    for (i=0; i<4; i++) {
+      memcpy(&c8, in+8*i, 8);
+      memcpy(&m8, (char *)prev+8*i, 8);
+      m8 ^= c8;
+      memcpy((char *)prev+8*i, &m8, 8);
+      memcpy(out+8*i, &m8, 8);
+    }
+    in += 32;
+    out += 32;
+    nblocks--;
+  }
+}
+
+/* as cfb_encrypt_blocks, starting at plaintext position pos of the
+   stream st, and restarting at chunk boundaries */
+static void cfb_encrypt_run(const leanocrypt_state_t *st, roundkey *rkk, xword32 prev[8], xword64 pos, const char *in, char *out, size_t nblocks) {
+  size_t m;
+
+  while (nblocks > 0) {
+    m = chunk_blocks(st, pos, nblocks);
+    cfb_encrypt_blocks(rkk, prev, in, out, m);
+    in += 32*m;
+    out += 32*m;
+    nblocks -= m;
+    pos += 32*m;
+    chunk_next(st, rkk, pos, prev);
+  }
+}
+
+/* make the IV of a new stream in st->buf, in the format given by
+   chunkshift */
+static void make_iv(leanocrypt_state_t *st, int chunkshift) {
   /* make a nonce */
   make_nonce(st->buf);
 
   /* mark the nonce with a "magic number". */
-  strncpy((char *)st->buf, MAGIC, 4);
+  if (chunkshift) {
+    strncpy((char *)st->buf, MAGICCHUNKED, 4);
+    ((xword8 *)st->buf)[4] = chunkshift;
+    chunk_init(st, st->buf);
+  } else {
+    strncpy((char *)st->buf, MAGIC, 4);
+  }
 
   /* encrypt the nonce with the given key */
   xrijndaelEncrypt(st->buf, &st->rkks[0]);
+}
+
+static int leanoencrypt_init_st(leanocrypt_stream_t *b, const leanocrypt_key_t *k, int chunkshift, void *mem, size_t size) {
+  leanocrypt_state_t *st;
+
+  b->state = NULL;
+  b->error = 0;
+
+  if (chunkshift != 0 && (chunkshift < leanocrypt_CHUNKSHIFTMIN || chunkshift > leanocrypt_CHUNKSHIFTMAX)) {
+    errno = EINVAL;
+    return -1;
+  }
+  
+  /* encryption uses only the first key */
+  st = leanocrypt_state_new(k, 0, mem, size);
+  if (st == NULL) {
+    return mem ? leanocrypt_fail(b, leanocrypt_EBUFFER) : -1;
+  }
+
+  make_iv(st, chunkshift);
 
   /* IV is now contained in st->buf. Initialize rest of the state. */
   st->iv = 1;
@@ -118,36 +743,127 @@ int leanoencrypt_init(leanocrypt_stream_t *b, const char *key) {
   return 0;
 }
 
+int leanoencrypt_init_mem(leanocrypt_stream_t *b, const leanocrypt_key_t *k, void *mem, size_t size) {
+  return leanoencrypt_init_st(b, k, 0, mem, size);
+}
+
+int leanoencrypt_init_key(leanocrypt_stream_t *b, const leanocrypt_key_t *k) {
+  return leanoencrypt_init_st(b, k, 0, NULL, 0);
+}
+
+int leanoencrypt_init_chunked(leanocrypt_stream_t *b, const leanocrypt_key_t *k, int chunkshift) {
+  return leanoencrypt_init_st(b, k, chunkshift, NULL, 0);
+}
+
+int leanoencrypt_init_keyid(leanocrypt_stream_t *b, const leanocrypt_key_t *k, int chunkshift) {
+  leanocrypt_state_t *st;
+  int r;
+
+  r = leanoencrypt_init_st(b, k, chunkshift, NULL, 0);
+  if (r) {
+    return r;
+  }
+  st = (leanocrypt_state_t *)b->state;
+  st->hdrbuf = (char *)malloc(32);
+  if (!st->hdrbuf) {
+    leanocrypt_state_free(st);
+    b->state = NULL;
+    return -1;
+  }
+  keyid_write(k, st->hdrbuf);
+  st->hdrsize = 32;
+  return 0;
+}
+
+int leanoencrypt_init_wrapped(leanocrypt_stream_t *b, const leanocrypt_key_t *const keys[], int nkeys, int nslots, int chunkshift) {
+  leanocrypt_state_t *st;
+  leanocrypt_key_t dkey;
+  roundkey dkrk;
+  xword32 dk[8];
+  int i, r;
+
+  b->state = NULL;
+  b->error = 0;
+
+  if (nkeys < 1 || nslots < nkeys || nslots > leanocrypt_MAXSLOTS) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  /* the data is a stream under a random key */
+  make_nonce(dk);
+  xrijndaelKeySched256(dk, &dkrk);
+  dkey.n = 1;
+  dkey.rkks = &dkrk;
+  r = leanoencrypt_init_st(b, &dkey, chunkshift, NULL, 0);
+  memset(&dkrk, 0, sizeof(dkrk));
+  if (r) {
+    memset(dk, 0, 32);
+    return r;
+  }
+  st = (leanocrypt_state_t *)b->state;
+
+  /* the marker, the key slots and the map, written before the IV */
+  st->hdrsize = MAPOFFSET(nslots) + 32;
+  st->hdrbuf = (char *)malloc(st->hdrsize);
+  if (!st->hdrbuf) {
+    memset(dk, 0, 32);
+    leanocrypt_state_free(st);
+    b->state = NULL;
+    return -1;
+  }
+  wrap_write(nslots, st->hdrbuf);
+  for (i=0; i<nslots; i++) {
+    if (i < nkeys) {
+      wrap_slot(&keys[i]->rkks[0], dk, nslots, st->hdrbuf + SLOTOFFSET(i));
+    } else {
+      make_nonce((xword32 *)st->aux);
+      memcpy(st->hdrbuf + SLOTOFFSET(i), st->aux, 32);
+      make_nonce((xword32 *)st->aux);
+      memcpy(st->hdrbuf + SLOTOFFSET(i) + 32, st->aux, 32);
+    }
+  }
+  map_write(&st->rkks[0], ((xword32)1 << nkeys) - 1, st->hdrbuf + MAPOFFSET(nslots));
+  memset(dk, 0, 32);
+  st->nslots = nslots;
+  return 0;
+}
+
+int leanoencrypt_init(leanocrypt_stream_t *b, const char *key) {
+  leanocrypt_key_t *k;
+  int r;
+
+  b->state = NULL;
+  b->error = 0;
+
+  k = leanocrypt_key_new(1, &key);
+  if (!k) {
+    return -1;
+  }
+  r = leanoencrypt_init_key(b, k);
+  leanocrypt_key_free(k);
+  return r;
+}
+
 int leanoencrypt(leanocrypt_stream_t *b) {
   leanocrypt_state_t *st = (leanocrypt_state_t *)b->state;
-  xword32 lbuf[8];
   char *cbuf = (char *)st->buf;
-  int i;
+  size_t m;
   char c, cc;
 
   while (1) {
-    /* handle the typical case efficiently, one block at a time */
+    /* handle the typical case efficiently, reading and writing the
+       caller's buffers directly */
 
     if (st->iv == 0 && st->bufindex == 32) {
-      while (b->avail_in >= 32 && b->avail_out >= 32) {
-
-	/* block-encrypt buffer */
-	xrijndaelEncrypt(st->buf, &st->rkks[0]);
-	
-	/* read input to local buffer for word alignment */
-	memcpy(lbuf, b->next_in, 32);
-	b->next_in += 32;
-	b->avail_in -= 32;
-	
-	/* compute ciphertext */
-	for (i=0; i<8; i++) {
-	  st->buf[i] ^= lbuf[i];
-	}
-
-	/* write output */
-	memcpy(b->next_out, st->buf, 32);
-	b->next_out += 32;
-	b->avail_out -= 32;
+      m = (b->avail_in < b->avail_out ? b->avail_in : b->avail_out) / 32;
+      if (m > 0) {
+	cfb_encrypt_run(st, &st->rkks[0], st->buf, st->pos, b->next_in, b->next_out, m);
+	st->pos += 32*m;
+	b->next_in += 32*m;
+	b->avail_in -= 32*m;
+	b->next_out += 32*m;
+	b->avail_out -= 32*m;
       }
     }
     
@@ -157,6 +873,14 @@ int leanoencrypt(leanocrypt_stream_t *b) {
       break;
     } 
 
+    else if (st->hdrlen < st->hdrsize) {
+      /* write header byte: key slot, map, or key identifier */
+      *b->next_out = st->hdrbuf[st->hdrlen];
+      b->next_out++;
+      b->avail_out--;
+      st->hdrlen++;
+    }
+
     else if (st->iv) {  /* write IV byte */
       *b->next_out = cbuf[st->bufindex];
       b->next_out++;
@@ -185,6 +909,8 @@ int leanoencrypt(leanocrypt_stream_t *b) {
       b->next_out++;
       b->avail_out--;
       st->bufindex++;
+      st->pos++;
+      chunk_next(st, &st->rkks[0], st->pos, st->buf);
     }
   }
   return 0;
@@ -199,32 +925,65 @@ int leanoencrypt_end(leanocrypt_stream_t *b) {
 /* ---------------------------------------------------------------------- */
 /* core functions for decryption */
 
-int leanodencrypt_multi_init(leanocrypt_stream_t *b, int n, const char **keylist, int flags) {
-  xword32 keyblock[8];
-  leanocrypt_state_t *st;
-  roundkey *rkks;
-  int i;
-  
-  b->state = NULL;
+/* CFB-decrypt nblocks whole blocks from in to out, which may be
+   equal. prev holds the ciphertext block preceding in; on return it
+   holds the last ciphertext block. In CFB decryption, each mask is the
+   encryption of the previous ciphertext block, so the masks for BATCH
+   blocks are computed at once, and then combined with the ciphertext
+   and written out in one pass. */
+static void cfb_decrypt_blocks(roundkey *rkk, xword32 prev[8], const char *in, char *out, size_t nblocks) {
+  xword32 mask[8*BATCH];
+  xword64 c, d;
+  size_t m, i;
 
-  st = (leanocrypt_state_t *)malloc(sizeof(leanocrypt_state_t));
-  if (st == NULL) {
-    return -1;
+  while (nblocks > 0) {
+    m = nblocks < BATCH ? nblocks : BATCH;
+
+    /* block-encrypt the previous ciphertext blocks */
+    memcpy(mask, prev, 32);
+    memcpy(mask+8, in, 32*(m-1));
+    memcpy(prev, in+32*(m-1), 32);
+    xrijndaelEncryptBlocks(mask, m, &rkk, 0);
+
+    /* compute and write plaintext. The ciphertext is read before the
+       plaintext overwrites it, in case in == out. */
+    for (i=0; i<4*m; i++) {
+      memcpy(&c, in+8*i, 8);
+      memcpy(&d, (char *)mask+8*i, 8);
+      d ^= c;
+      memcpy(out+8*i, &d, 8);
+    }
+    in += 32*m;
+    out += 32*m;
+    nblocks -= m;
   }
-  rkks = (roundkey *)malloc(n * sizeof(roundkey));
-  if (!rkks) {
-    free(st);
-    return -1;
+}
+
+/* as cfb_decrypt_blocks, starting at plaintext position pos of the
+   stream st, and restarting at chunk boundaries */
+static void cfb_decrypt_run(const leanocrypt_state_t *st, roundkey *rkk, xword32 prev[8], xword64 pos, const char *in, char *out, size_t nblocks) {
+  size_t m;
+
+  while (nblocks > 0) {
+    m = chunk_blocks(st, pos, nblocks);
+    cfb_decrypt_blocks(rkk, prev, in, out, m);
+    in += 32*m;
+    out += 32*m;
+    nblocks -= m;
+    pos += 32*m;
+    chunk_next(st, rkk, pos, prev);
   }
+}
 
-  st->n = n;
-  st->rkks = rkks;
-  st->ak = 0;
+int leanodencrypt_init_mem(leanocrypt_stream_t *b, const leanocrypt_key_t *k, int flags, void *mem, size_t size) {
+  leanocrypt_state_t *st;
 
-  /* generate the roundkeys */
-  for (i=0; i<n; i++) {
-    hashstring(keylist[i], keyblock);
-    xrijndaelKeySched(keyblock, 256, 256, &st->rkks[i]);
+  b->state = NULL;
+  b->error = 0;
+
+  st = leanocrypt_state_new(k, 1, mem, size);
+  if (st == NULL) {
+    return mem ? leanocrypt_fail(b, leanocrypt_EBUFFER) : -1;
   }
 
   /* Initialize rest of the state. */
@@ -236,15 +995,138 @@ int leanodencrypt_multi_init(leanocrypt_stream_t *b, int n, const char **keylist
   return 0;
 }
 
+int leanodencrypt_init_key(leanocrypt_stream_t *b, const leanocrypt_key_t *k, int flags) {
+  return leanodencrypt_init_mem(b, k, flags, NULL, 0);
+}
+
+int leanodencrypt_multi_init(leanocrypt_stream_t *b, int n, const char **keylist, int flags) {
+  leanocrypt_key_t *k;
+  int r;
+
+  b->state = NULL;
+  b->error = 0;
+
+  k = leanocrypt_key_new(n, keylist);
+  if (!k) {
+    return -1;
+  }
+  r = leanodencrypt_init_key(b, k, flags);
+  leanocrypt_key_free(k);
+  return r;
+}
+
 int leanodencrypt_init(leanocrypt_stream_t *b, const char *key, int flags) {
   return leanodencrypt_multi_init(b, 1, &key, flags);
 }
 
+/* continue with a copy of the matching key rkks[m] only, and release
+   the shared keys */
+static void key_select(leanocrypt_state_t *st, int m) {
+  roundkey *own = (roundkey *)((char *)st + STATEHEAD);
+
+  if (st->ring) {
+    memcpy(own, &st->rkks[m], sizeof(roundkey));
+    key_release(st->ring);
+    st->ring = NULL;
+    st->rkks = own;
+    st->n = 1;
+    m = 0;
+  }
+  st->ak = m;
+}
+
+/* process the header block in st->buf. Return 1 if it was the IV of
+   the data, 0 if more header follows, or minus a leanocrypt error. */
+static int header_block(leanocrypt_state_t *st) {
+  xword32 nonce[8];
+  int m;
+
+  switch (st->hdr) {
+
+  case HDR_IV: default:
+    /* a key identifier selects the key to try on the IV */
+    if (st->slot == 0 && st->ring && keyid_block((char *)st->buf)) {
+      m = keyid_lookup(st->ring, (xword8 *)st->buf + 32 - KEYIDSIZE);
+      if (m < 0 && (st->flags & leanocrypt_MISMATCH) == 0) {
+	return -leanocrypt_EMISMATCH;
+      }
+      st->ak = m < 0 ? 0 : m;
+      st->hdr = HDR_KEYIV;
+      return 0;
+    }
+
+    /* a marker announces the key slots of the wrapped format */
+    if (st->slot == 0 && st->nslots == 0 && wrap_block((char *)st->buf)) {
+      st->nslots = wrap_block((char *)st->buf);
+      return 0;
+    }
+
+    /* find the first matching key */
+    m = match_key(st->rkks, st->n, st->buf, st->flags, nonce);
+    if (m >= 0 && strncmp((char *)nonce, MAGICWRAPPED, 4) == 0) {
+      /* a slot must agree with the marker */
+      if (((xword8 *)nonce)[4] != st->nslots) {
+	return -leanocrypt_EFORMAT;
+      }
+      key_select(st, m);
+      memcpy(st->aux, st->buf, 32);
+      st->hdr = HDR_WRAPKEY;
+      return 0;
+    } else if (m >= 0 && st->nslots == 0) {
+      key_select(st, m);
+      return chunk_init(st, nonce) ? -leanocrypt_EFORMAT : 1;
+    }
+    /* in the wrapped format, a matching key may be in a later slot.
+       Skip the rest of this slot. */
+    if (st->slot + 1 >= st->nslots) {
+      return -leanocrypt_EMISMATCH;
+    }
+    st->slot++;
+    st->skip = 32;
+    return 0;
+
+  case HDR_WRAPKEY:
+    /* continue with the data key, after the other slots and the map */
+    unwrap_slot(&st->rkks[st->ak], st->aux, st->buf, st->aux);
+    xrijndaelKeySched256(st->aux, &st->dk);
+    st->rkks = &st->dk;
+    st->n = 1;
+    st->ak = 0;
+    st->skip = SLOTSIZE*(st->nslots - st->slot - 1) + 32;
+    st->hdr = HDR_DATAIV;
+    return 0;
+
+  case HDR_DATAIV:
+    if (match_key(st->rkks, 1, st->buf, 0, nonce) < 0
+	|| strncmp((char *)nonce, MAGICWRAPPED, 4) == 0) {
+      return -leanocrypt_EMISMATCH;
+    }
+    return chunk_init(st, nonce) ? -leanocrypt_EFORMAT : 1;
+
+  case HDR_KEYIV:
+    if (match_key(&st->rkks[st->ak], 1, st->buf, st->flags, nonce) < 0) {
+      return -leanocrypt_EMISMATCH;
+    }
+    if (strncmp((char *)nonce, MAGICWRAPPED, 4) == 0) {
+      return -leanocrypt_EFORMAT;
+    }
+    key_select(st, st->ak);
+    return chunk_init(st, nonce) ? -leanocrypt_EFORMAT : 1;
+  }
+}
+
+/* the error for a stream that ends within the header: a key mismatch
+   if no slot matched, or else a bad format */
+static int header_error(const leanocrypt_state_t *st) {
+  return st->hdr == HDR_IV && st->slot > 0 ? leanocrypt_EMISMATCH : leanocrypt_EFORMAT;
+}
+
 int leanodencrypt(leanocrypt_stream_t *b) {
   leanocrypt_state_t *st = (leanocrypt_state_t *)b->state;
-  xword32 lbuf[8];
+  roundkey *rkk = &st->rkks[st->ak];
   char *cbuf = (char *)st->buf;
-  int i;
+  size_t k;
+  int m;
   char c, cc;
   
   while (1) {
@@ -252,25 +1134,14 @@ int leanodencrypt(leanocrypt_stream_t *b) {
 
     if (st->iv == 0 && st->bufindex == 32) {
       while (b->avail_in >= 32 && b->avail_out >= 32) {
-	
-	/* block-encrypt buffer */
-        xrijndaelEncrypt(st->buf, &st->rkks[st->ak]);
-	memcpy(lbuf, st->buf, 32);
-
-	/* read input */
-	memcpy(st->buf, b->next_in, 32);
-	b->next_in += 32;
-	b->avail_in -= 32;
-
-	/* compute plaintext */
-	for (i=0; i<8; i++) {
-	  lbuf[i] ^= st->buf[i];
-	}
 
-	/* write output */
-	memcpy(b->next_out, lbuf, 32);
-	b->next_out += 32;
-	b->avail_out -= 32;
+	k = (b->avail_in < b->avail_out ? b->avail_in : b->avail_out) / 32;
+	cfb_decrypt_run(st, rkk, st->buf, st->pos, b->next_in, b->next_out, k);
+	st->pos += 32*k;
+	b->next_in += 32*k;
+	b->avail_in -= 32*k;
+	b->next_out += 32*k;
+	b->avail_out -= 32*k;
       }
     }
 
@@ -280,32 +1151,33 @@ int leanodencrypt(leanocrypt_stream_t *b) {
       break;
     }
 
-    else if (st->iv) {  /* read IV byte */
+    else if (st->iv && st->skip) {  /* skip header bytes */
+      k = b->avail_in < st->skip ? b->avail_in : st->skip;
+      b->next_in += k;
+      b->avail_in -= k;
+      st->skip -= k;
+      st->hdrlen += k;
+    }
+
+    else if (st->iv) {  /* read IV or header byte */
       cbuf[st->bufindex] = *b->next_in;
       b->next_in++;
       b->avail_in--;
       st->bufindex++;
+      st->hdrlen++;
       if (st->bufindex == 32) {
-	st->iv = 0;
-	/* find the first matching key */
-	for (i=0; i<st->n; i++) {
-	  /* check the "magic number" */
-	  memcpy(lbuf, st->buf, 32);
-	  xrijndaelDecrypt(lbuf, &st->rkks[i]);
-	  if ((st->flags & leanocrypt_MISMATCH) != 0 || strncmp((char *)lbuf, MAGIC, 4) == 0) {
-	    /* key matches */
-	    break;
-	  }
-	}
-	if (i<st->n) { /* matching key found */
-	  st->ak = i;
-	} else {       /* not found */
+	m = header_block(st);
+	if (m == 1) {  /* matching key found */
+	  st->iv = 0;
+	  rkk = &st->rkks[st->ak];
+	} else if (m == 0) {
+	  st->bufindex = 0;
+	} else {
 	  /* on error, invalidate the state so that the client cannot
 	     call here again. */
 	  leanocrypt_state_free((leanocrypt_state_t *)b->state);
 	  b->state = NULL;
-	  leanocrypt_errno = leanocrypt_EMISMATCH;
-	  return -2;
+	  return leanocrypt_fail(b, -m);
 	}
       }
     }
@@ -316,7 +1188,7 @@ int leanodencrypt(leanocrypt_stream_t *b) {
 
     else {              /* decrypt one byte */
       if (st->bufindex == 32) {
-	xrijndaelEncrypt(st->buf, &st->rkks[st->ak]);
+	xrijndaelEncrypt(st->buf, rkk);
 	st->bufindex = 0;
       }
       cc = *b->next_in;
@@ -328,23 +1200,668 @@ int leanodencrypt(leanocrypt_stream_t *b) {
       b->next_out++;
       b->avail_out--;
       st->bufindex++;
+      st->pos++;
+      chunk_next(st, rkk, st->pos, st->buf);
+    }
+  }
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+/* random access */
+
+int leanodencrypt_seek(leanocrypt_stream_t *b, const char prev[32], off_t offset) {
+  leanocrypt_state_t *st = (leanocrypt_state_t *)b->state;
+
+  if (offset < 0 || offset % 32 != 0) {
+    errno = EINVAL;
+    return -1;
+  }
+  if (st->iv) {
+    return leanocrypt_fail(b, leanocrypt_EFORMAT);
+  }
+  st->pos = offset;
+  memcpy(st->buf, prev, 32);
+  if (offset > 0) {
+    chunk_next(st, &st->rkks[st->ak], st->pos, st->buf);
+  }
+  st->bufindex = 32;
+  return 0;
+}
+
+/* read up to len bytes at offset, retrying after short reads. Return
+   the number of bytes read, or -1 with errno set. */
+static ssize_t pread_full(int fd, char *buf, size_t len, off_t offset) {
+  size_t done = 0;
+  ssize_t r;
+
+  while (done < len) {
+    r = pread(fd, buf+done, len-done, offset+done);
+    if (r < 0 && errno == EINTR) {
+      continue;
+    } else if (r < 0) {
+      return -1;
+    } else if (r == 0) {
+      break;
+    }
+    done += r;
+  }
+  return done;
+}
+
+/* write len bytes at offset, retrying after short writes. Return 0,
+   or -1 with errno set. */
+static int pwrite_full(int fd, const char *buf, size_t len, off_t offset) {
+  size_t done = 0;
+  ssize_t r;
+
+  while (done < len) {
+    r = pwrite(fd, buf+done, len-done, offset+done);
+    if (r < 0 && errno == EINTR) {
+      continue;
+    } else if (r < 0) {
+      return -1;
+    }
+    done += r;
+  }
+  return 0;
+}
+
+/* read and check the header of the encrypted file fd, up to and
+   including the IV of the data, unless this was done already. */
+static int read_header(leanocrypt_stream_t *b, int fd) {
+  leanocrypt_stream_t s = *b;
+  leanocrypt_state_t *st = (leanocrypt_state_t *)b->state;
+  char block[32];
+  ssize_t n;
+  int r;
+
+  while (st->iv) {
+    if (st->skip) {
+      st->hdrlen += st->skip;
+      st->skip = 0;
+      continue;
+    }
+    n = pread_full(fd, block, 32 - st->bufindex, st->hdrlen);
+    if (n < 0) {
+      return -1;
+    } else if (n == 0) {
+      return leanocrypt_fail(b, header_error(st));
+    }
+    s.next_in = block;
+    s.avail_in = n;
+    s.avail_out = 0;
+    r = leanodencrypt(&s);
+    b->state = s.state;
+    b->error = s.error;
+    if (r) {
+      return r;
+    }
+  }
+  return 0;
+}
+
+ssize_t leanodencrypt_pread(leanocrypt_stream_t *b, int fd, char *buf, size_t len, off_t offset) {
+  leanocrypt_stream_t s = *b;   /* work on a copy of the caller's fields */
+  leanocrypt_state_t *st;
+  char block[32];
+  ssize_t n;
+  off_t k, base;
+  int r;
+
+  if (offset < 0) {
+    errno = EINVAL;
+    return -1;
+  }
+
+  r = read_header(b, fd);
+  if (r) {
+    return r;
+  }
+  if (len == 0) {
+    return 0;
+  }
+  st = (leanocrypt_state_t *)b->state;
+  base = st->hdrlen;  /* the offset of the data after the IV */
+
+  /* restart at the block containing offset, and skip to offset */
+  k = offset / 32;
+  n = pread_full(fd, block, 32, base - 32 + 32*k);
+  if (n < 32) {
+    return n < 0 ? -1 : 0;
+  }
+  leanodencrypt_seek(&s, block, 32*k);
+  if (offset % 32) {
+    n = pread_full(fd, block, offset % 32, base + 32*k);
+    if (n < offset % 32) {
+      return n < 0 ? -1 : 0;
+    }
+    s.next_in = s.next_out = block;
+    s.avail_in = s.avail_out = n;
+    leanodencrypt(&s);
+  }
+
+  /* decrypt the range in place */
+  n = pread_full(fd, buf, len, base + offset);
+  if (n < 0) {
+    return -1;
+  }
+  s.next_in = s.next_out = buf;
+  s.avail_in = s.avail_out = n;
+  leanodencrypt(&s);
+  return n;
+}
+
+int leanoencrypt_resume(leanocrypt_stream_t *b, int fd, const leanocrypt_key_t *k) {
+  leanocrypt_state_t *st;
+  char block[32];
+  off_t end, len, blk;
+  ssize_t n;
+  int tail, r, e, err;
+
+  r = leanodencrypt_init_key(b, k, 0);
+  if (r) {
+    return r;
+  }
+  r = read_header(b, fd);
+  if (r) {
+    goto error;
+  }
+  st = (leanocrypt_state_t *)b->state;  /* with the matching key only */
+
+  end = lseek(fd, 0, SEEK_END);
+  if (end == -1) {
+    r = -1;
+    goto error;
+  }
+  len = end - st->hdrlen;  /* plaintext bytes so far */
+  blk = len - len % 32;
+  tail = len % 32;
+
+  /* restart at the last block, as leanodencrypt_seek does, then
+     restore its ciphertext bytes and the mask for the rest */
+  n = pread_full(fd, block, 32, st->hdrlen - 32 + blk);
+  if (n != 32) {
+    r = n < 0 ? -1 : leanocrypt_fail(b, leanocrypt_EFORMAT);
+    goto error;
+  }
+  leanodencrypt_seek(b, block, blk);
+  if (tail) {
+    n = pread_full(fd, block, tail, st->hdrlen + blk);
+    if (n != tail) {
+      r = n < 0 ? -1 : leanocrypt_fail(b, leanocrypt_EFORMAT);
+      goto error;
+    }
+    xrijndaelEncrypt(st->buf, &st->rkks[0]);
+    memcpy(st->buf, block, tail);
+    st->bufindex = tail;
+    st->pos += tail;
+  }
+  return 0;
+
+ error:
+  e = errno;
+  err = b->error;
+  leanodencrypt_end(b);
+  errno = e;
+  if (r == -2) {
+    b->error = err;
+    leanocrypt_errno = err;
+  }
+  return r;
+}
+
+int leanocrypt_rewrap(int fd, const leanocrypt_key_t *oldkey, const leanocrypt_key_t *newkey, int flags) {
+  leanocrypt_stream_t s;
+  leanocrypt_state_t *st;
+  char slot[SLOTSIZE], map[32];
+  xword32 blk[8], nonce[8];
+  xword32 used;
+  int i, r, e, err;
+
+  r = leanodencrypt_init_key(&s, oldkey, 0);
+  if (r) {
+    return r;
+  }
+  r = read_header(&s, fd);
+  if (r) {
+    goto done;
+  }
+  st = (leanocrypt_state_t *)s.state;
+  if (st->nslots == 0) {
+    r = leanocrypt_fail(&s, leanocrypt_EFORMAT);
+    goto done;
+  }
+
+  if (pread_full(fd, map, 32, MAPOFFSET(st->nslots)) != 32) {
+    r = -1;
+    goto done;
+  }
+  used = map_read(&st->dk, map);
+
+  /* the slot to write: the matching one, or a free one */
+  i = st->slot;
+  if (flags & leanocrypt_ADDKEY) {
+    /* nothing to do if newkey already opens a used slot */
+    for (i=0; i<st->nslots; i++) {
+      if ((used & ((xword32)1 << i)) == 0) {
+	continue;
+      }
+      if (pread_full(fd, slot, 32, SLOTOFFSET(i)) != 32) {
+	r = -1;
+	goto done;
+      }
+      memcpy(blk, slot, 32);
+      if (match_key(&newkey->rkks[0], 1, blk, 0, nonce) >= 0
+	  && strncmp((char *)nonce, MAGICWRAPPED, 4) == 0) {
+	goto done;
+      }
     }
+    for (i=0; i<st->nslots && (used & ((xword32)1 << i)); i++)
+      ;
+    if (i == st->nslots) {
+      r = leanocrypt_fail(&s, leanocrypt_ENOSLOT);
+      goto done;
+    }
+  }
+  used |= (xword32)1 << i;
+
+  wrap_slot(&newkey->rkks[0], st->aux, st->nslots, slot);
+  map_write(&st->dk, used, map);
+  if (pwrite_full(fd, slot, SLOTSIZE, SLOTOFFSET(i)) != 0
+      || pwrite_full(fd, map, 32, MAPOFFSET(st->nslots)) != 0) {
+    r = -1;
+  }
+
+ done:
+  if (r) {
+    e = errno;
+    err = s.error;
+    leanodencrypt_end(&s);
+    errno = e;
+    if (r == -2) {
+      leanocrypt_errno = err;
+    }
+    return r;
+  }
+  return leanodencrypt_end(&s);
+}
+
+/* ---------------------------------------------------------------------- */
+/* parallel encryption and decryption */
+
+/* one range of blocks for cfb_encrypt_run or cfb_decrypt_run */
+typedef struct cfb_job_s {
+  const leanocrypt_state_t *st;
+  roundkey *rkk;
+  int encrypt;
+  xword32 prev[8];
+  xword64 pos;
+  const char *in;
+  char *out;
+  size_t nblocks;
+  int *pending;          /* jobs of the same call not yet done */
+  struct cfb_job_s *next; /* in the queue of the pool */
+} cfb_job_t;
+
+static void *cfb_job_run(void *arg) {
+  cfb_job_t *job = (cfb_job_t *)arg;
+
+  if (job->encrypt) {
+    cfb_encrypt_run(job->st, job->rkk, job->prev, job->pos, job->in, job->out, job->nblocks);
+  } else {
+    cfb_decrypt_run(job->st, job->rkk, job->prev, job->pos, job->in, job->out, job->nblocks);
+  }
+  return NULL;
+}
+
+#ifdef HAVE_LIBPTHREAD
+/* The jobs are run by a pool of worker threads, shared by all streams.
+   It grows to the largest number of threads asked for, and its threads
+   wait for more jobs until the process exits, so that each call only
+   pays for waking them up. The calling thread runs the first job, and
+   then any queued job, so the jobs are done even if no worker could be
+   started, or the pool was lost across a fork. */
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_work = PTHREAD_COND_INITIALIZER; /* queued */
+static pthread_cond_t pool_done = PTHREAD_COND_INITIALIZER; /* finished */
+static cfb_job_t *pool_queue = NULL;
+static int pool_size = 0;
+
+/* run the job at the head of the queue. Called and returns with
+   pool_lock held. */
+static void pool_run(void) {
+  cfb_job_t *job = pool_queue;
+
+  pool_queue = job->next;
+  pthread_mutex_unlock(&pool_lock);
+  cfb_job_run(job);
+  pthread_mutex_lock(&pool_lock);
+  if (--*job->pending == 0) {
+    pthread_cond_broadcast(&pool_done);
   }
+}
+
+static void *pool_worker(void *arg) {
+  (void)arg;
+  pthread_mutex_lock(&pool_lock);
+  while (1) {
+    while (pool_queue == NULL) {
+      pthread_cond_wait(&pool_work, &pool_lock);
+    }
+    pool_run();
+  }
+  return NULL;
+}
+#endif
+
+/* run njobs jobs in parallel if possible */
+static void cfb_jobs_run(cfb_job_t *jobs, int njobs) {
+#ifdef HAVE_LIBPTHREAD
+  pthread_t thread;
+  int pending = njobs - 1;
+  int j;
+
+  pthread_mutex_lock(&pool_lock);
+  while (pool_size < njobs - 1) {
+    if (pthread_create(&thread, NULL, pool_worker, NULL) != 0) {
+      break;
+    }
+    pthread_detach(thread);
+    pool_size++;
+  }
+  for (j=1; j<njobs; j++) {
+    jobs[j].pending = &pending;
+    jobs[j].next = pool_queue;
+    pool_queue = &jobs[j];
+  }
+  pthread_cond_broadcast(&pool_work);
+  pthread_mutex_unlock(&pool_lock);
+
+  cfb_job_run(&jobs[0]);
+
+  pthread_mutex_lock(&pool_lock);
+  while (pending > 0) {
+    if (pool_queue) {
+      pool_run();
+    } else {
+      pthread_cond_wait(&pool_done, &pool_lock);
+    }
+  }
+  pthread_mutex_unlock(&pool_lock);
+#else
+  int j;
+
+  for (j=0; j<njobs; j++) {
+    cfb_job_run(&jobs[j]);
+  }
+#endif
+}
+
+/* do the whole blocks (or, for encryption, whole chunks) of n at
+   next_in in up to nthreads ranges, and advance the stream past them.
+   The first range continues from st->buf; each later one is seeded
+   with its chunk IV or with the ciphertext block before it, which must
+   be copied before any output is written, since in and out may be the
+   same buffer. */
+static int cfb_parallel(leanocrypt_stream_t *b, int encrypt, size_t n, int nthreads) {
+  leanocrypt_state_t *st = (leanocrypt_state_t *)b->state;
+  roundkey *rkk = &st->rkks[st->ak];
+  size_t unit, a;
+  cfb_job_t *jobs;
+  int j;
+
+  /* encryption is split at chunk boundaries only */
+  unit = encrypt ? ((size_t)1 << st->chunkshift) / 32 : 1;
+  n /= unit;
+
+  jobs = (cfb_job_t *)malloc(nthreads * sizeof(cfb_job_t));
+  if (!jobs) {
+    return -1;
+  }
+  a = 0;
+  for (j=0; j<nthreads; j++) {
+    jobs[j].st = st;
+    jobs[j].rkk = rkk;
+    jobs[j].encrypt = encrypt;
+    jobs[j].nblocks = unit * (n / nthreads + (j < (int)(n % nthreads) ? 1 : 0));
+    jobs[j].pos = st->pos + 32*a;
+    jobs[j].in = b->next_in + 32*a;
+    jobs[j].out = b->next_out + 32*a;
+    if (j == 0) {
+      memcpy(jobs[j].prev, st->buf, 32);
+    } else if (encrypt) {
+      chunk_iv(st, rkk, jobs[j].pos >> st->chunkshift, jobs[j].prev);
+    } else {
+      memcpy(jobs[j].prev, b->next_in + 32*(a-1), 32);
+      chunk_next(st, rkk, jobs[j].pos, jobs[j].prev);
+    }
+    a += jobs[j].nblocks;
+  }
+  cfb_jobs_run(jobs, nthreads);
+
+  /* the state continues from the last range */
+  memcpy(st->buf, jobs[nthreads-1].prev, 32);
+  free(jobs);
+  st->pos += 32*a;
+  b->next_in += 32*a;
+  b->avail_in -= 32*a;
+  b->next_out += 32*a;
+  b->avail_out -= 32*a;
   return 0;
 }
 
+/* the number of threads to use for n blocks at next_in, given that
+   each thread should get at least min blocks */
+static int cfb_threads(leanocrypt_stream_t *b, size_t n, size_t min, int nthreads) {
+  /* if the output trails the input within the same buffer, as after
+     reading the IV in place, one range would overwrite the input of
+     the range before it */
+  if (b->next_out != b->next_in && b->next_out + 32*n > b->next_in
+      && b->next_in + 32*n > b->next_out) {
+    return 1;
+  }
+  if (nthreads > (int)(n / min)) {
+    nthreads = n / min;
+  }
+  return nthreads;
+}
+
+int leanodencrypt_parallel(leanocrypt_stream_t *b, int nthreads) {
+  leanocrypt_state_t *st = (leanocrypt_state_t *)b->state;
+  size_t k, rest;
+  size_t n;
+  int r;
+
+  /* read the header and the rest of a partial block serially */
+  while ((st->iv && b->avail_in > 0) || (!st->iv && st->bufindex != 32)) {
+    if (st->skip) {
+      k = st->skip;
+    } else {
+      k = 32 - st->bufindex;
+    }
+    rest = b->avail_in > k ? b->avail_in - k : 0;
+    b->avail_in -= rest;
+    r = leanodencrypt(b);
+    b->avail_in += rest;
+    if (r != 0) {
+      return r;
+    }
+    st = (leanocrypt_state_t *)b->state;
+    if (!st->iv && st->bufindex != 32) {
+      return 0;
+    }
+  }
+  if (st->iv) {
+    return 0;
+  }
+
+  n = (b->avail_in < b->avail_out ? b->avail_in : b->avail_out) / 32;
+  nthreads = cfb_threads(b, n, MINBLOCKS, nthreads);
+  if (nthreads > 1 && cfb_parallel(b, 0, n, nthreads) != 0) {
+    return -1;
+  }
+
+  /* the remaining bytes */
+  return leanodencrypt(b);
+}
+
+int leanoencrypt_parallel(leanocrypt_stream_t *b, int nthreads) {
+  leanocrypt_state_t *st = (leanocrypt_state_t *)b->state;
+  xword64 chunk;
+  size_t k, rest;
+  size_t n, min;
+  int r;
+
+  /* streams in the serial format can only be encrypted serially */
+  if (st->chunkshift == 0) {
+    return leanoencrypt(b);
+  }
+  chunk = (xword64)1 << st->chunkshift;
+
+  /* write the IV and the rest of a partial chunk serially */
+  if (st->iv || (st->pos & (chunk - 1)) != 0) {
+    k = chunk - (st->pos & (chunk - 1));
+    rest = b->avail_in > k ? b->avail_in - k : 0;
+    b->avail_in -= rest;
+    r = leanoencrypt(b);
+    b->avail_in += rest;
+    if (r != 0) {
+      return r;
+    }
+    if (st->iv || (st->pos & (chunk - 1)) != 0) {
+      return 0;
+    }
+  }
+
+  n = (b->avail_in < b->avail_out ? b->avail_in : b->avail_out) / 32;
+  min = chunk / 32 > MINBLOCKS ? chunk / 32 : MINBLOCKS;
+  nthreads = cfb_threads(b, n, min, nthreads);
+  if (nthreads > 1 && cfb_parallel(b, 1, n, nthreads) != 0) {
+    return -1;
+  }
+
+  /* the remaining bytes */
+  return leanoencrypt(b);
+}
+
+/* is the encryption stream b at a block boundary, with a whole block
+   to encrypt? */
+static int lane_ready(leanocrypt_stream_t *b) {
+  leanocrypt_state_t *st = (leanocrypt_state_t *)b->state;
+
+  return st->iv == 0 && st->bufindex == 32
+    && b->avail_in >= 32 && b->avail_out >= 32;
+}
+
+/* advance the up to LANES streams b[0..n-1], one block of each ready
+   stream per kernel call */
+static void lanes_run(leanocrypt_stream_t *b[], int n) {
+  xword32 blk[8*LANES];
+  roundkey *rkp[LANES];
+  int idx[LANES];
+  leanocrypt_state_t *st;
+  xword64 c, d;
+  int i, j, m;
+
+  while (1) {
+    /* gather the masks of the ready streams */
+    m = 0;
+    for (i=0; i<n; i++) {
+      if (lane_ready(b[i])) {
+	st = (leanocrypt_state_t *)b[i]->state;
+	memcpy(blk+8*m, st->buf, 32);
+	rkp[m] = &st->rkks[0];
+	idx[m] = i;
+	m++;
+      }
+    }
+    if (m == 0) {
+      break;
+    }
+    xrijndaelEncryptBlocks(blk, m, rkp, 1);
+
+    /* combine them with the plaintext, and keep the ciphertext as the
+       next block's input */
+    for (j=0; j<m; j++) {
+      leanocrypt_stream_t *bi = b[idx[j]];
+      st = (leanocrypt_state_t *)bi->state;
+      for (i=0; i<4; i++) {
+	memcpy(&c, bi->next_in+8*i, 8);
+	memcpy(&d, (char *)(blk+8*j)+8*i, 8);
+	d ^= c;
+	memcpy(bi->next_out+8*i, &d, 8);
+      }
+      memcpy(st->buf, bi->next_out, 32);
+      bi->next_in += 32;
+      bi->avail_in -= 32;
+      bi->next_out += 32;
+      bi->avail_out -= 32;
+      st->pos += 32;
+      chunk_next(st, rkp[j], st->pos, st->buf);
+    }
+  }
+}
+
+int leanoencrypt_lanes(leanocrypt_stream_t *b[], int n) {
+  leanocrypt_state_t *st;
+  size_t k, rest;
+  int i, r;
+
+  /* bring each stream to a block boundary: write its header and IV,
+     and finish a partial block */
+  for (i=0; i<n; i++) {
+    st = (leanocrypt_state_t *)b[i]->state;
+    k = st->iv ? 0 : (32 - st->bufindex) % 32;
+    rest = b[i]->avail_in > k ? b[i]->avail_in - k : 0;
+    b[i]->avail_in -= rest;
+    r = leanoencrypt(b[i]);
+    b[i]->avail_in += rest;
+    if (r != 0) {
+      return r;
+    }
+  }
+
+  /* the whole blocks, LANES streams at a time */
+  for (i=0; i<n; i+=LANES) {
+    lanes_run(b+i, n-i < LANES ? n-i : LANES);
+  }
+
+  /* the remaining bytes */
+  for (i=0; i<n; i++) {
+    r = leanoencrypt(b[i]);
+    if (r != 0) {
+      return r;
+    }
+  }
+  return 0;
+}
+
+int leanodencrypt_verified(const leanocrypt_stream_t *b) {
+  leanocrypt_state_t *st = (leanocrypt_state_t *)b->state;
+
+  return st && !st->iv;
+}
+
+int leanodencrypt_slots(const leanocrypt_stream_t *b) {
+  leanocrypt_state_t *st = (leanocrypt_state_t *)b->state;
+
+  return st && !st->iv ? st->nslots : 0;
+}
+
 int leanodencrypt_end(leanocrypt_stream_t *b) {
   leanocrypt_state_t *st;
+  int r;
   
   if (b->state) {
 
     /* verify that we have read and verified the IV */
     st = (leanocrypt_state_t *)b->state;
     if (st->iv) {
+      r = header_error(st);
       leanocrypt_state_free((leanocrypt_state_t *)b->state);
       b->state = NULL;
-      leanocrypt_errno = leanocrypt_EFORMAT;
-      return -2;
+      return leanocrypt_fail(b, r);
     }
   }
 
@@ -352,3 +1869,86 @@ int leanodencrypt_end(leanocrypt_stream_t *b) {
   b->state = NULL;
   return 0;
 }
+
+/* ---------------------------------------------------------------------- */
+/* one-shot encryption and decryption of buffers */
+
+/* CFB-encrypt or decrypt the final len < 32 bytes from in to out,
+   given the preceding ciphertext block prev. */
+static void cfb_tail(roundkey *rkk, const xword32 prev[8], const char *in, char *out, size_t len) {
+  xword32 mask[8];
+  size_t i;
+
+  memcpy(mask, prev, 32);
+  xrijndaelEncrypt(mask, rkk);
+  for (i=0; i<len; i++) {
+    out[i] = in[i] ^ ((char *)mask)[i];
+  }
+}
+
+int leanoencrypt_buffer(const leanocrypt_key_t *k, const char *in, size_t len, char *out) {
+  roundkey *rkk = &k->rkks[0];
+  xword32 mask[8];
+  xword64 c, m;
+  int i;
+
+  /* the IV, as in leanoencrypt_init_key */
+  make_nonce(mask);
+  strncpy((char *)mask, MAGIC, 4);
+  xrijndaelEncrypt(mask, rkk);
+  memcpy(out, mask, 32);
+  out += 32;
+
+  /* each ciphertext block is the mask for the next one */
+  for (; len >= 32; len -= 32) {
+    xrijndaelEncrypt(mask, rkk);
+    for (i=0; i<4; i++) {
+      memcpy(&c, in+8*i, 8);
+      memcpy(&m, (char *)mask+8*i, 8);
+      m ^= c;
+      memcpy((char *)mask+8*i, &m, 8);
+      memcpy(out+8*i, &m, 8);
+    }
+    in += 32;
+    out += 32;
+  }
+  cfb_tail(rkk, mask, in, out, len);
+  return 0;
+}
+
+int leanodencrypt_buffer(const leanocrypt_key_t *k, const char *in, size_t len, char *out, int flags) {
+  leanocrypt_state_t st;   /* only the format fields are used */
+  roundkey *rkk;
+  xword32 prev[8], nonce[8];
+  int ak;
+
+  if (len < 32) {
+    leanocrypt_errno = leanocrypt_EFORMAT;
+    return -2;
+  }
+  /* a key identifier or a wrapped marker would only be tried as an IV */
+  if (keyid_block(in) || wrap_block(in)) {
+    leanocrypt_errno = leanocrypt_EFORMAT;
+    return -2;
+  }
+  memcpy(prev, in, 32);
+  ak = match_key(k->rkks, k->n, prev, flags, nonce);
+  if (ak < 0) {
+    leanocrypt_errno = leanocrypt_EMISMATCH;
+    return -2;
+  }
+  if (strncmp((char *)nonce, MAGICWRAPPED, 4) == 0
+      || chunk_init(&st, nonce) != 0) {
+    leanocrypt_errno = leanocrypt_EFORMAT;
+    return -2;
+  }
+  rkk = &k->rkks[ak];
+  in += 32;
+  len -= 32;
+
+  cfb_decrypt_run(&st, rkk, prev, 0, in, out, len / 32);
+  in += len & ~(size_t)31;
+  out += len & ~(size_t)31;
+  cfb_tail(rkk, prev, in, out, len & 31);
+  return 0;
+}
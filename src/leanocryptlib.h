@@ -4,21 +4,47 @@
 #ifndef _leanocryptLIB_H
 #define _leanocryptLIB_H
 
+#include <sys/types.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/* The version of this interface. Version 2 changed the layout of
+   leanocrypt_stream_t: the buffer sizes became size_t instead of
+   unsigned int, and the error field was added. Code built against
+   version 1 must be recompiled; leanocrypt_version() returns the
+   version the library was built with, for checking at run time. */
+#define leanocrypt_VERSION 2
+int leanocrypt_version(void);
+
+/* The buffer sizes are size_t, so that a single call may cover any
+   buffer the process can address, such as a large mmap'd file. */
 struct leanocrypt_stream_s {
   char          *next_in;  /* next input byte */
-  unsigned int  avail_in;  /* number of bytes available at next_in */
+  size_t        avail_in;  /* number of bytes available at next_in */
 
   char          *next_out; /* next output byte should be put there */
-  unsigned int  avail_out; /* remaining free space at next_out */
+  size_t        avail_out; /* remaining free space at next_out */
 
   void *state;             /* internal state, not visible by applications */
+  int error;               /* leanocrypt error of the last call returning -2 */
 };
 typedef struct leanocrypt_stream_s leanocrypt_stream_t;
 
+/* Streams may be processed in place. For decryption, next_out may be
+   equal to next_in, or trail it within the same buffer, as happens
+   when the IV is read in place. For encryption, which writes the IV
+   before reading input, next_out may be equal to next_in once the IV
+   has been written. Buffers need not be aligned.
+
+   The library keeps no shared state that is not locked: independent
+   streams may be used from different threads at the same time, and
+   may share a precomputed key. This holds only when it is built with
+   POSIX threads (configure warns otherwise). Without them nothing is
+   locked, the parallel functions run in the calling thread, and the
+   library must be used from one thread only. */
+
 int leanoencrypt_init(leanocrypt_stream_t *b, const char *key);
 int leanoencrypt     (leanocrypt_stream_t *b);
 int leanoencrypt_end (leanocrypt_stream_t *b);
@@ -27,20 +53,152 @@ int leanodencrypt_init(leanocrypt_stream_t *b, const char *key, int flags);
 int leanodencrypt     (leanocrypt_stream_t *b);
 int leanodencrypt_end (leanocrypt_stream_t *b);
 
+/* nonzero once a decryption stream has read and checked its header,
+   so that all further input is data */
+int leanodencrypt_verified(const leanocrypt_stream_t *b);
+
+/* the number of key slots of a verified stream in the wrapped format,
+   else 0 */
+int leanodencrypt_slots(const leanocrypt_stream_t *b);
 
 int leanodencrypt_multi_init(leanocrypt_stream_t *b, int n, const char **keylist, int flags);
 
+/* A precomputed key holds the expanded round keys of n passphrases,
+   so that they are hashed once rather than once per stream. It may
+   be freed while streams initialized from it are in use. Encryption
+   uses the first key; decryption tries all of them, as
+   leanodencrypt_multi_init. A decryption stream shares the keys until
+   one matches the header, which is tried against several keys per
+   call to the cipher kernel, so that a keyring of many passphrases
+   is cheap to reuse for many files. leanocrypt_key_new returns NULL
+   with errno set on error. */
+typedef struct leanocrypt_key_s leanocrypt_key_t;
+
+leanocrypt_key_t *leanocrypt_key_new(int n, const char **keylist);
+void leanocrypt_key_free(leanocrypt_key_t *k);
+
+int leanoencrypt_init_key(leanocrypt_stream_t *b, const leanocrypt_key_t *k);
+int leanodencrypt_init_key(leanocrypt_stream_t *b, const leanocrypt_key_t *k, int flags);
+
+/* Streams normally allocate their state. Alternatively, the caller
+   may provide leanocrypt_state_size() bytes of storage at mem,
+   aligned as for malloc. The size does not depend on the number of
+   keys, since a stream keeps only the key in use. The storage is not
+   freed by _end, and may be reused for another stream afterwards. The
+   _mem functions return -2 with leanocrypt_errno set to
+   leanocrypt_EBUFFER if size is too small. */
+size_t leanocrypt_state_size(void);
+int leanoencrypt_init_mem(leanocrypt_stream_t *b, const leanocrypt_key_t *k, void *mem, size_t size);
+int leanodencrypt_init_mem(leanocrypt_stream_t *b, const leanocrypt_key_t *k, int flags, void *mem, size_t size);
+
+/* One-shot encryption and decryption of a whole message of len bytes,
+   without a stream. leanoencrypt_buffer writes exactly len+32 bytes to
+   out; leanodencrypt_buffer writes exactly len-32 bytes to out, or
+   returns -2 with leanocrypt_errno set. For decryption, out may be
+   equal to in; otherwise the buffers must not overlap. The wrapped
+   format and key identifiers are not supported. */
+int leanoencrypt_buffer(const leanocrypt_key_t *k, const char *in, size_t len, char *out);
+int leanodencrypt_buffer(const leanocrypt_key_t *k, const char *in, size_t len, char *out, int flags);
+
+/* Random access to a decryption stream. A CFB block depends only on
+   the ciphertext block before it. After the IV has been read,
+   leanodencrypt_seek restarts the stream at the block at plaintext
+   offset offset, a multiple of 32, given the preceding 32 bytes of
+   ciphertext (or the IV, for the first block). leanodencrypt_pread
+   decrypts len bytes at plaintext offset offset of the encrypted file
+   fd, reading and checking the header first if necessary. It returns
+   the number of bytes decrypted, which is short only at the end of
+   the file; the fields of b other than state are not changed. Both
+   return -1 with errno or -2 with leanocrypt_errno set on error. */
+int leanodencrypt_seek(leanocrypt_stream_t *b, const char prev[32], off_t offset);
+ssize_t leanodencrypt_pread(leanocrypt_stream_t *b, int fd, char *buf, size_t len, off_t offset);
+
+/* as leanoencrypt, for the n encryption streams b[0..n-1] at once.
+   The streams are advanced in lockstep, one block of each per call to
+   the cipher kernel, so that independent streams share its throughput
+   rather than each waiting for its latency. The streams may use
+   different keys and formats. */
+int leanoencrypt_lanes(leanocrypt_stream_t *b[], int n);
+
+/* Appending to an encrypted file. leanoencrypt_resume reads and
+   checks the header of the encrypted file fd, and initializes b as an
+   encryption stream that continues the file where it ends, in its
+   format and under its key. Its output, which has no IV, must be
+   written at the end of the file; fd is left positioned there. It
+   returns -1 with errno or -2 with leanocrypt_errno set on error. */
+int leanoencrypt_resume(leanocrypt_stream_t *b, int fd, const leanocrypt_key_t *k);
+
+/* as leanodencrypt, but decrypt the whole blocks available at next_in
+   in up to nthreads threads. If next_out trails next_in within the
+   same buffer, this is done in one thread. The threads come from a
+   pool that is shared by all streams and kept until the process
+   exits. Each is given at least 256 KB; smaller buffers are decrypted
+   in fewer threads, or in the calling thread. */
+int leanodencrypt_parallel(leanocrypt_stream_t *b, int nthreads);
+
+/* The chunked format splits the plaintext into chunks of
+   2^chunkshift bytes, each encrypted on its own, so that chunks can
+   be encrypted in parallel. Decryption recognizes the format
+   automatically. It has no size overhead, so random access works as
+   for the serial format. leanoencrypt_init_chunked returns -1 with
+   errno set to EINVAL if chunkshift is out of range.
+   leanoencrypt_parallel is as leanoencrypt, but encrypts the whole
+   chunks available at next_in in up to nthreads threads, at least
+   256 KB or one chunk per thread; for a stream in the serial format,
+   it is the same as leanoencrypt. */
+#define leanocrypt_CHUNKSHIFT    20     /* default chunk size: 1 MB */
+#define leanocrypt_CHUNKSHIFTMIN 12
+#define leanocrypt_CHUNKSHIFTMAX 30
+
+int leanoencrypt_init_chunked(leanocrypt_stream_t *b, const leanocrypt_key_t *k, int chunkshift);
+int leanoencrypt_parallel(leanocrypt_stream_t *b, int nthreads);
+
+/* leanoencrypt_init_keyid is as leanoencrypt_init_chunked, but
+   precedes the IV with a block carrying an identifier of the key.
+   Decryption then looks the key up in its keyring, rather than trying
+   each key on the IV; files without it are still matched by trial.
+   The identifier does not help to find the key, but it tells which
+   files share a key. */
+int leanoencrypt_init_keyid(leanocrypt_stream_t *b, const leanocrypt_key_t *k, int chunkshift);
+
+/* The wrapped format encrypts the data under a random data key, and
+   stores that key in nslots key slots, each encrypted under the key of
+   one recipient. Unused slots are filled with random bytes. The header
+   takes 64*nslots+64 bytes. Decryption recognizes the format
+   automatically. leanoencrypt_init_wrapped writes the first nkeys
+   slots for the first key of each of keys[0..nkeys-1], and encrypts
+   the data in the chunked format if chunkshift is not 0; it returns -1
+   with errno set to EINVAL if nkeys or nslots is out of range.
+   leanocrypt_rewrap changes the key of the slot of the open wrapped
+   file fd that matches oldkey to newkey, or, with the flag
+   leanocrypt_ADDKEY, adds newkey in a free slot unless it already
+   opens one, without touching the data. It returns -2 with
+   leanocrypt_errno set to leanocrypt_EFORMAT if the file is not in the
+   wrapped format, or to leanocrypt_ENOSLOT if there is no free slot. Since a slot that does not match cannot be
+   told from random bytes, a decryption stream reports a key mismatch
+   only after trying all nslots slots, or at _end. */
+#define leanocrypt_MAXSLOTS      16
+
+int leanoencrypt_init_wrapped(leanocrypt_stream_t *b, const leanocrypt_key_t *const keys[], int nkeys, int nslots, int chunkshift);
+int leanocrypt_rewrap(int fd, const leanocrypt_key_t *oldkey, const leanocrypt_key_t *newkey, int flags);
+
 /* errors */
 
 #define leanocrypt_EFORMAT   1          /* bad file format */
 #define leanocrypt_EMISMATCH 2          /* key does not match */
 #define leanocrypt_EBUFFER   3          /* buffer overflow */
+#define leanocrypt_ENOSLOT   4          /* no free key slot */
+#define leanocrypt_EWRAPPED  5          /* would drop the key slots */
 
 /* flags */
 
 #define leanocrypt_MISMATCH  1          /* ignore non-matching key */
+#define leanocrypt_ADDKEY    2          /* leanocrypt_rewrap: add a key */
 
-extern int leanocrypt_errno;
+/* Errors are also available through leanocrypt_errno, which, like
+   errno, is local to the calling thread. */
+int *leanocrypt_errno_location(void);
+#define leanocrypt_errno (*leanocrypt_errno_location())
 
 #ifdef  __cplusplus
 } // end of extern "C"
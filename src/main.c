@@ -16,6 +16,7 @@
 #include "main.h"
 #include "readkey.h"
 #include "leanocrypt.h"
+#include "rijndael.h"
 #include "traverse.h"
 #include "xalloc.h"
 #include "unixcryptlib.h"
@@ -50,7 +51,8 @@ _("Commands:\n"
 "    -E,  read keyword from environment variable (unsafe)\n"
 "    -K,  give keyword on command line (unsafe)\n"
 "    -t,  prompt twice for encryption keys (default)\n"
-"    -k,  read keyword(s) as first line(s) from file\n"
+"    -k,  read keyword(s) as first line(s) from file; when decrypting,\n"
+"         each line of a file other than - is a key to try\n"
 "    -S,  use suffix .suf instead of default %s\n"
 "    -r,  recurse through directories\n"
 "    -R,  follow symbolic links as subdirectories\n"
@@ -63,6 +65,17 @@ _("Commands:\n"
 "    -y,  encryption key must match this encrypted file\n"
 "    -l,  dereference symbolic links\n"
 "    -T,  use temporary files instead of overwriting (unsafe)\n"
+"    --range OFFSET:LEN  decrypt LEN bytes from OFFSET to stdout (LEN\n"
+"         may be omitted for the rest of the file)\n"
+"    --chunked  encrypt in the chunked format, which can be encrypted\n"
+"         in parallel\n"
+"    --wrapped  encrypt in the wrapped format, whose key can be changed\n"
+"         without re-encrypting the file\n"
+"    --add-key  with -x, add the second key to files in the wrapped\n"
+"         format, keeping the first\n"
+"    --append  encrypt stdin onto the end of one encrypted file\n"
+"    --key-id  store an identifier of the key, so that decryption with\n"
+"         many keys (-k) finds it at once; shows which files share a key\n"
 "    --   end of options, filenames follow\n"),
 	  SUF);
 }
@@ -99,6 +112,12 @@ static void output_commandline(cmdline cmd, FILE *fout) {
   fprintf(fout, "mode = %s\n", mode[cmd.mode]);
   fprintf(fout, "filter = %s\n", cmd.filter ? "yes" : "no");
   fprintf(fout, "tmpfiles = %s\n", cmd.tmpfiles ? "yes" : "no");
+  fprintf(fout, "range = %s\n", cmd.range ? "yes" : "no");
+  fprintf(fout, "chunked = %s\n", cmd.chunkshift ? "yes" : "no");
+  fprintf(fout, "wrapped = %s\n", cmd.wrapslots ? "yes" : "no");
+  fprintf(fout, "addkey = %s\n", cmd.addkey ? "yes" : "no");
+  fprintf(fout, "append = %s\n", cmd.append ? "yes" : "no");
+  fprintf(fout, "keyid = %s\n", cmd.keyid ? "yes" : "no");
   fprintf(fout, "suffix = %s\n", cmd.suffix);
   fprintf(fout, "prompt = %s\n", cmd.prompt ? cmd.prompt : _("(none)"));
   fprintf(fout, "prompt2 = %s\n", cmd.prompt2 ? cmd.prompt2 : _("(none)"));
@@ -146,6 +165,12 @@ static struct option longopts[] = {
   {"rec-symlinks", 0, 0, 'R'},
   {"symlinks",     0, 0, 'l'},
   {"tmpfiles",     0, 0, 'T'},
+  {"range",        1, 0, 'O'},  /* no short option */
+  {"chunked",      0, 0, 'C'},  /* no short option */
+  {"wrapped",      0, 0, 'W'},  /* no short option */
+  {"add-key",      0, 0, 'A'},  /* no short option */
+  {"append",       0, 0, 'Z'},  /* no short option */
+  {"key-id",       0, 0, 'I'},  /* no short option */
   {0, 0, 0, 0}
 };
 
@@ -155,12 +180,15 @@ static cmdline read_commandline(int ac, char *av[]) {
   cmdline cmd;
   int c;
   char *p;
+  int showversion = 0;
 
   /* defaults: */
   cmd.verbose = 0;
   cmd.debug = 0;
   cmd.keyword = NULL;
   cmd.keyword2 = NULL;
+  cmd.key = NULL;
+  cmd.key2 = NULL;
   cmd.mode = ENCRYPT;
   cmd.suffix = SUF;
   cmd.prompt = NULL;
@@ -177,6 +205,14 @@ static cmdline read_commandline(int ac, char *av[]) {
   cmd.keyref = NULL;
   cmd.strictsuffix = 0;
   cmd.tmpfiles = 0;
+  cmd.range = 0;
+  cmd.rangeoffset = 0;
+  cmd.rangelen = -1;
+  cmd.chunkshift = 0;
+  cmd.wrapslots = 0;
+  cmd.addkey = 0;
+  cmd.append = 0;
+  cmd.keyid = 0;
 
   /* find the basename with which we were invoked */
   cmd.name = strrchr(av[0], '/');
@@ -199,8 +235,7 @@ static cmdline read_commandline(int ac, char *av[]) {
       exit(0);
       break;
     case 'V':
-      version(stdout);
-      exit(0);
+      showversion = 1;
       break;
     case 'L':
       license(stdout);
@@ -324,6 +359,34 @@ static cmdline read_commandline(int ac, char *av[]) {
     case 'T':
       cmd.tmpfiles = 1;
       break;
+    case 'O':
+      cmd.range = 1;
+      cmd.rangeoffset = strtoll(optarg, &p, 10);
+      if (*p == ':' && p[1] != 0) {
+	cmd.rangelen = strtoll(p+1, &p, 10);
+      } else if (*p == ':') {
+	p++;
+      }
+      if (*p || cmd.rangeoffset < 0 || cmd.rangelen < -1) {
+	fprintf(stderr, _("%s: invalid range -- %s\n"), cmd.name, optarg);
+	exit(1);
+      }
+      break;
+    case 'C':
+      cmd.chunkshift = leanocrypt_CHUNKSHIFT;
+      break;
+    case 'W':
+      cmd.wrapslots = 4;
+      break;
+    case 'A':
+      cmd.addkey = 1;
+      break;
+    case 'Z':
+      cmd.append = 1;
+      break;
+    case 'I':
+      cmd.keyid = 1;
+      break;
     case '?':
       fprintf(stderr, _("Try --help for more information.\n"));
       exit(1);
@@ -334,6 +397,14 @@ static cmdline read_commandline(int ac, char *av[]) {
     }
   }
 
+  if (showversion) {
+    version(stdout);
+    if (cmd.verbose > 0) {
+      fprintf(stdout, _("Cipher kernel: %s\n"), xrijndaelKernel());
+    }
+    exit(0);
+  }
+
   cmd.infiles = &av[optind];
   cmd.count = ac-optind;
 
@@ -344,6 +415,31 @@ static cmdline read_commandline(int ac, char *av[]) {
     cmd.filter = 0;
   }
 
+  /* --range decrypts one file, or stdin, to stdout */
+  if (cmd.range) {
+    if (cmd.count > 1) {
+      fprintf(stderr, _("%s: option --range can only be used with one file.\n"), cmd.name);
+      exit(1);
+    }
+    cmd.mode = CAT;
+  }
+
+  /* --append encrypts stdin onto one file. The key is checked against
+     the file, so it is read only once. */
+  if (cmd.append) {
+    if (cmd.count != 1 || cmd.mode != ENCRYPT || cmd.range) {
+      fprintf(stderr, _("%s: option --append can only be used with -e and one file.\n"), cmd.name);
+      exit(1);
+    }
+    cmd.timid = 0;
+  }
+
+  /* the wrapped format has a key slot per key instead */
+  if (cmd.keyid && cmd.wrapslots) {
+    fprintf(stderr, _("%s: options --key-id and --wrapped cannot be used together.\n"), cmd.name);
+    exit(1);
+  }
+
   /* in certain modes, allow symlinks by default */
   if (cmd.mode == CAT || cmd.mode == UNIXCRYPT) {
     cmd.symlinks = 1;
@@ -361,6 +457,12 @@ static cmdline read_commandline(int ac, char *av[]) {
     exit(1);
   }
 
+  /* adding a key updates files in place */
+  if (cmd.addkey && (cmd.mode!=KEYCHANGE || cmd.filter || cmd.tmpfiles)) {
+    fprintf(stderr, _("%s: option --add-key can only be used with -x on files, without -T.\n"), cmd.name);
+    exit(1);
+  }
+
   /* if not in filter mode, and 0 filenames follow, don't bother continuing */
   if (!cmd.filter && cmd.count==0) {
     if (cmd.verbose>=0) {
@@ -403,6 +505,8 @@ static cmdline read_commandline(int ac, char *av[]) {
 int main(int ac, char *av[]) {
   int r;
   FILE *f;
+  char **keyring = NULL;  /* with -k when decrypting: all keys to try */
+  int nkeys = 0;
 
 #if ENABLE_NLS
   setlocale (LC_ALL, "");
@@ -439,6 +543,18 @@ int main(int ac, char *av[]) {
 	exit(9);
       }
     }
+    /* when decrypting, the remaining lines are further keys to try,
+       unless the key is read from stdin, where the data may follow */
+    if ((cmd.mode==DECRYPT || cmd.mode==CAT) && f != stdin) {
+      char *line;
+
+      nkeys = 1;
+      keyring = (char **)xalloc(sizeof(char *), cmd.name);
+      while ((line = xreadline(f, cmd.name)) != NULL) {
+	keyring = (char **)xrealloc(keyring, (nkeys+1) * sizeof(char *), cmd.name);
+	keyring[nkeys++] = line;
+      }
+    }
     if (strcmp(cmd.keyfile, "-")!=0) {
       fclose(f);
     }
@@ -507,6 +623,33 @@ int main(int ac, char *av[]) {
     }
   }
 
+  /* hash the keys once for the whole run */
+  if (cmd.mode != UNIXCRYPT && nkeys > 1) {
+    keyring[0] = cmd.keyword;
+    cmd.key = leanocrypt_keyring_new_r(nkeys, (const char **)keyring);
+    while (--nkeys > 0) {
+      free(keyring[nkeys]);
+    }
+    if (!cmd.key) {
+      fprintf(stderr, "%s: %s\n", cmd.name, strerror(errno));
+      exit(2);
+    }
+  } else if (cmd.mode != UNIXCRYPT) {
+    cmd.key = leanocrypt_key_new_r(cmd.keyword);
+    if (!cmd.key) {
+      fprintf(stderr, "%s: %s\n", cmd.name, strerror(errno));
+      exit(2);
+    }
+  }
+  free(keyring);
+  if (cmd.mode == KEYCHANGE) {
+    cmd.key2 = leanocrypt_key_new_r(cmd.keyword2);
+    if (!cmd.key2) {
+      fprintf(stderr, "%s: %s\n", cmd.name, strerror(errno));
+      exit(2);
+    }
+  }
+
   /* reset stdin/stdout to binary mode under Windows */
   setmode(0,O_BINARY);
   setmode(1,O_BINARY);
@@ -519,9 +662,9 @@ int main(int ac, char *av[]) {
       exit(10);
     }
     if (cmd.mode == ENCRYPT) {
-      r = keycheck_stream(f, cmd.keyword);
+      r = keycheck_stream(f, cmd.key);
     } else {
-      r = keycheck_stream(f, cmd.keyword2);
+      r = keycheck_stream(f, cmd.key2);
     }
     if (r == -2 && (leanocrypt_errno == leanocrypt_EFORMAT || leanocrypt_errno == leanocrypt_EMISMATCH)) {
       fprintf(stderr, _("The encryption key does not match the reference file.\n"));
@@ -536,21 +679,91 @@ int main(int ac, char *av[]) {
     }
   }
 
+  /* decrypt a range of one file with pread */
+
+  if (cmd.range) {
+    int fd = 0;
+
+    if (cmd.count == 1) {
+      fd = open(cmd.infiles[0], O_RDONLY | O_BINARY);
+      if (fd < 0) {
+	fprintf(stderr, "%s: %s: %s\n", cmd.name, cmd.infiles[0], strerror(errno));
+	return 2;
+      }
+    }
+    r = leanodencrypt_range(fd, stdout, cmd.key, cmd.mismatch ? leanocrypt_MISMATCH : 0, cmd.rangeoffset, cmd.rangelen);
+
+    free(cmd.keyword);
+    free(cmd.keyword2);
+    leanocrypt_key_free(cmd.key);
+    leanocrypt_key_free(cmd.key2);
+
+    if (r) {
+      fprintf(stderr, "%s: %s\n", cmd.name, leanocrypt_error(r));
+      if (r==-2 && (leanocrypt_errno==leanocrypt_EFORMAT || leanocrypt_errno==leanocrypt_EMISMATCH)) {
+	return 4;
+      } else if (r == -3) {
+	return 3;
+      } else {
+	return 2;
+      }
+    }
+    r = fflush(stdout);
+    if (r == EOF) {
+      fprintf(stderr, "%s: %s\n", cmd.name, strerror(errno));
+      return 3;
+    }
+    return 0;
+  }
+
+  /* encrypt stdin onto the end of one file */
+
+  if (cmd.append) {
+    int fd;
+
+    fd = open(cmd.infiles[0], O_RDWR | O_BINARY);
+    if (fd < 0) {
+      fprintf(stderr, "%s: %s: %s\n", cmd.name, cmd.infiles[0], strerror(errno));
+      return 2;
+    }
+    r = leanoencrypt_append(fd, stdin, cmd.key);
+    if (close(fd) && !r) {
+      r = -3;
+    }
+
+    free(cmd.keyword);
+    free(cmd.keyword2);
+    leanocrypt_key_free(cmd.key);
+    leanocrypt_key_free(cmd.key2);
+
+    if (r) {
+      fprintf(stderr, "%s: %s: %s\n", cmd.name, cmd.infiles[0], leanocrypt_error(r));
+      if (r==-2 && (leanocrypt_errno==leanocrypt_EFORMAT || leanocrypt_errno==leanocrypt_EMISMATCH)) {
+	return 4;
+      } else if (r == -3) {
+	return 3;
+      } else {
+	return 2;
+      }
+    }
+    return 0;
+  }
+
   /* filter mode */
 
   if (cmd.filter) {   
     switch (cmd.mode) {  
 
     case ENCRYPT: default:
-      r = leanoencrypt_streams(stdin, stdout, cmd.keyword);
+      r = leanoencrypt_streams(stdin, stdout, cmd.key, cmd.chunkshift, cmd.wrapslots, cmd.keyid);
       break;
 
     case DECRYPT: case CAT:
-      r = leanodencrypt_streams(stdin, stdout, cmd.keyword);
+      r = leanodencrypt_streams(stdin, stdout, cmd.key, cmd.mismatch ? leanocrypt_MISMATCH : 0);
       break;
 
     case KEYCHANGE:
-      r = cckeychange_streams(stdin, stdout, cmd.keyword, cmd.keyword2);
+      r = cckeychange_streams(stdin, stdout, cmd.key, cmd.key2, cmd.chunkshift, cmd.wrapslots, cmd.keyid);
       break;
 
     case UNIXCRYPT:
@@ -560,6 +773,8 @@ int main(int ac, char *av[]) {
 
     free(cmd.keyword);
     free(cmd.keyword2);
+    leanocrypt_key_free(cmd.key);
+    leanocrypt_key_free(cmd.key2);
 
     if (r) {
       fprintf(stderr, "%s: %s\n", cmd.name, leanocrypt_error(r));
@@ -584,6 +799,8 @@ int main(int ac, char *av[]) {
 
   free(cmd.keyword);
   free(cmd.keyword2);
+  leanocrypt_key_free(cmd.key);
+  leanocrypt_key_free(cmd.key2);
 
   if (r==1) {
     return 4;
@@ -3,6 +3,9 @@
 #ifndef __MAIN_H
 #define __MAIN_H
 
+#include <sys/types.h>
+#include "leanocryptlib.h"
+
 /* modes */
 #define ENCRYPT   0
 #define DECRYPT   1
@@ -17,6 +20,8 @@ typedef struct {
   int debug;    
   char *keyword;
   char *keyword2;    /* when changing keys: new key */
+  leanocrypt_key_t *key;  /* keyword, hashed once for the whole run */
+  leanocrypt_key_t *key2; /* keyword2, hashed once for the whole run */
   int mode;          /* ENCRYPT, DECRYPT, KEYCHANGE, CAT, UNIXCRYPT */
   int filter;        /* running as a filter? */
   int tmpfiles;      /* use temporary files instead of overwriting? */
@@ -33,6 +38,14 @@ typedef struct {
   int timid;         /* prompt twice for encryption keys? */
   char *keyref;      /* if set, compare encryption key to this file */
   int strictsuffix;  /* refuse to encrypt files which already have suffix */
+  int range;         /* decrypt only part of a file? */
+  off_t rangeoffset; /* with range: first plaintext byte */
+  off_t rangelen;    /* with range: number of bytes, or -1 for all */
+  int chunkshift;    /* encrypt in the chunked format? log2 chunk size or 0 */
+  int wrapslots;     /* encrypt in the wrapped format? key slots or 0 */
+  int addkey;        /* with keychange: add the second key instead? */
+  int append;        /* encrypt stdin onto the end of an encrypted file? */
+  int keyid;         /* encrypt with a key identifier? */
 } cmdline;
 
 extern cmdline cmd;
@@ -103,7 +103,7 @@ static void printbox8(word8 b[256], char *name)
 {
   int i;
 
-  printf("xword8 %s[256] = {", name);
+  printf("xword8 %s[256] XCACHEALIGN = {", name);
   for (i = 0; i < 256; i++) {
     if (i % 14 == 0) {
       printf("\n  ");
@@ -113,48 +113,245 @@ static void printbox8(word8 b[256], char *name)
   printf("\n};\n\n");
 }
 
-/* ---------------------------------------------------------------------- */
-
-int main()
+/* print a table of 4 rotations of 256 words; f(rot, m, r) computes
+   the word for byte m */
+static void printbox32(void (*f)(int rot, word8 m, word8 r[4]), char *name)
 {
-  int rot, m, i, rcon;
+  int rot, m;
   word8 r[4];
 
-  printf("/* Copyright (C) 2022 Komeil Majidi.\n");
-  printf("   This file is part of leanocrypt. It is free software and it is covered\n");
-  printf("   by the GNU general public license. See the file COPYING for details. */\n\n");
-
-  printf("/* generated by maketables.c */\n\n");
-
-  printf("#include \"rijndael.h\"\n\n");
-
-  printf("xword8x4 M0[4][256] = {");
+  printf("xword8x4 %s[4][256] XCACHEALIGN = {", name);
   for (rot = 0; rot < 4; rot++) {
     printf("\n {");
     for (m = 0; m < 256; m++) {
       if (m % 3 == 0) {
 	printf("\n  ");
       }
-      multrot2113(rot, m, r);
+      f(rot, m, r);
       printf("{{%3d, %3d, %3d, %3d}}, ", r[0], r[1], r[2], r[3]);
     }
     printf("\n },");
   }
   printf("\n};\n\n");
+}
 
-  printf("xword8x4 M1[4][256] = {");
-  for (rot = 0; rot < 4; rot++) {
-    printf("\n {");
-    for (m = 0; m < 256; m++) {
-      if (m % 3 == 0) {
-	printf("\n  ");
+/* print the words for rotation 0 only, for the compact layout */
+static void printbox32c(void (*f)(int rot, word8 m, word8 r[4]), char *name)
+{
+  int m;
+  word8 r[4];
+
+  printf("xword8x4 %s[256] XCACHEALIGN = {", name);
+  for (m = 0; m < 256; m++) {
+    if (m % 3 == 0) {
+      printf("\n  ");
+    }
+    f(0, m, r);
+    printf("{{%3d, %3d, %3d, %3d}}, ", r[0], r[1], r[2], r[3]);
+  }
+  printf("\n};\n\n");
+}
+
+/* ---------------------------------------------------------------------- */
+/* tables for the word-oriented kernel, which combine the S-box with
+   the MixColumn multiplication of M0. The last round has no
+   MixColumn, and only places the S-box output in byte rot. */
+
+static void subst2113(int rot, word8 m, word8 r[4])
+{
+  multrot2113(rot, sbox[m], r);
+}
+
+static void substlast(int rot, word8 m, word8 r[4])
+{
+  r[0] = r[1] = r[2] = r[3] = 0;
+  r[rot] = sbox[m];
+}
+
+/* the same for decryption, with the inverse S-box and the
+   InvMixColumn multiplication of M1 */
+
+static void substie9db(int rot, word8 m, word8 r[4])
+{
+  multrote9db(rot, sibox[m], r);
+}
+
+static void substilast(int rot, word8 m, word8 r[4])
+{
+  r[0] = r[1] = r[2] = r[3] = 0;
+  r[rot] = sibox[m];
+}
+
+/* ---------------------------------------------------------------------- */
+/* tables for the vector-permute kernel. A byte x is written as
+   x = i e + k with i, k in the subfield GF(2^4), where e is a root of
+   z^2 + a z + a. Its inverse is then p f1 + q f2, where 1/p and 1/q
+   can be computed from i, k, and j = i + k with 16-entry lookups only:
+
+     1/p = 1/(1/i + a/k) + j,   1/q = 1/(1/j + a/k) + i.
+
+   The value 0x80 stands for the inverse of 0; a lookup with such an
+   index returns 0, which handles the cases where i, j, or k is 0. */
+
+static word8 gf16[16];		/* nibble -> element of GF(2^4) */
+static word8 nib[256];		/* element of GF(2^4) -> nibble */
+static word8 tower[256];	/* x -> (i << 4) | k */
+static word8 vpa, vpf1, vpf2;
+
+static word8 vpin[2][16], vpdin[2][16];
+static word8 vpinv[2][16];
+static word8 vpout[2][16], vpdout[2][16];
+
+static word8 power(word8 a, int n)
+{
+  word8 r = 1;
+
+  while (n-- > 0) {
+    r = multiply(r, a);
+  }
+  return r;
+}
+
+static word8 xdiv(word8 a, word8 b)
+{
+  return multiply(a, xinv(b));
+}
+
+/* the affine part of the S-box, without the constant */
+static word8 xaffine(word8 a)
+{
+  return sbox[xinv(a)] ^ 99;
+}
+
+/* byte lookup as done by pshufb */
+static word8 pshufb(word8 t[16], word8 x)
+{
+  return (x & 0x80) ? 0 : t[x & 15];
+}
+
+/* apply the lookups of the vector-permute S-box to x */
+static word8 vpsbox(word8 in[2][16], word8 out[2][16], word8 x)
+{
+  word8 t, i, j, k, ak, iak, jak, io, jo;
+
+  t = in[0][x & 15] ^ in[1][x >> 4];
+  k = t & 15;
+  i = t >> 4;
+  j = i ^ k;
+  ak = pshufb(vpinv[1], k);
+  iak = pshufb(vpinv[0], i) ^ ak;
+  jak = pshufb(vpinv[0], j) ^ ak;
+  io = pshufb(vpinv[0], iak) ^ j;
+  jo = pshufb(vpinv[0], jak) ^ i;
+  return pshufb(out[0], io) ^ pshufb(out[1], jo);
+}
+
+static int makevp()
+{
+  word8 g, a, e, ebar, x, c;
+  int n, m, b;
+
+  /* GF(2^4) is generated by g = 3^17, with basis 1, g, g^2, g^3 */
+  g = power(3, 17);
+  for (n = 0; n < 16; n++) {
+    gf16[n] = 0;
+    for (b = 0; b < 4; b++) {
+      if (n & (1 << b)) {
+	gf16[n] ^= power(g, b);
       }
-      multrote9db(rot, m, r);
-      printf("{{%3d, %3d, %3d, %3d}}, ", r[0], r[1], r[2], r[3]);
     }
-    printf("\n },");
+    nib[gf16[n]] = n;
+  }
+
+  /* find a such that z^2 + a z + a is irreducible over GF(2^4) */
+  for (n = 1; n < 16; n++) {
+    a = gf16[n];
+    for (m = 0; m < 16; m++) {
+      x = gf16[m];
+      if ((multiply(x, x) ^ multiply(a, x) ^ a) == 0) {
+	break;
+      }
+    }
+    if (m == 16) {
+      break;
+    }
+  }
+  vpa = a;
+  for (e = 2; (multiply(e, e) ^ multiply(a, e) ^ a) != 0; e++)
+    ;
+  ebar = power(e, 16);
+  vpf2 = xdiv(ebar ^ a, multiply(a, a));
+  vpf1 = 1 ^ multiply(1 ^ a, vpf2);
+
+  for (n = 0; n < 16; n++) {
+    for (m = 0; m < 16; m++) {
+      tower[multiply(gf16[n], e) ^ gf16[m]] = (n << 4) | m;
+    }
+  }
+
+  /* input transformations; for decryption, undo the affine part */
+  c = tower[xinv(sibox[0])];
+  for (n = 0; n < 16; n++) {
+    vpin[0][n] = tower[n];
+    vpin[1][n] = tower[n << 4];
+    vpdin[0][n] = tower[xinv(sibox[n])];
+    vpdin[1][n] = tower[xinv(sibox[n << 4])] ^ c;
+  }
+
+  /* inversion and output transformations */
+  vpinv[0][0] = vpinv[1][0] = 0x80;
+  vpout[0][0] = vpout[1][0] = vpdout[0][0] = vpdout[1][0] = 0;
+  for (n = 1; n < 16; n++) {
+    vpinv[0][n] = nib[xinv(gf16[n])];
+    vpinv[1][n] = nib[xdiv(a, gf16[n])];
+    vpdout[0][n] = multiply(xinv(gf16[n]), vpf1);
+    vpdout[1][n] = multiply(xinv(gf16[n]), vpf2);
+    vpout[0][n] = xaffine(vpdout[0][n]);
+    vpout[1][n] = xaffine(vpdout[1][n]);
+  }
+
+  /* check the result; encryption adds the constant 99 separately */
+  for (n = 0; n < 256; n++) {
+    if ((vpsbox(vpin, vpout, n) ^ 99) != sbox[n]
+	|| vpsbox(vpdin, vpdout, n) != sibox[n]) {
+      fprintf(stderr, "maketables: vector-permute tables failed for %d\n", n);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void printvp(word8 t[2][16], char *name)
+{
+  int n, m;
+
+  printf("xword8 %s[2][16] XCACHEALIGN = {", name);
+  for (n = 0; n < 2; n++) {
+    printf("\n  {");
+    for (m = 0; m < 16; m++) {
+      printf("%3d, ", t[n][m]);
+    }
+    printf("},");
   }
   printf("\n};\n\n");
+}
+
+/* ---------------------------------------------------------------------- */
+
+int main()
+{
+  int i, rcon;
+
+  printf("/* Copyright (C) 2022 Komeil Majidi.\n");
+  printf("   This file is part of leanocrypt. It is free software and it is covered\n");
+  printf("   by the GNU general public license. See the file COPYING for details. */\n\n");
+
+  printf("/* generated by maketables.c */\n\n");
+
+  printf("#include \"rijndael.h\"\n\n");
+
+  printbox32(multrot2113, "M0");
+  printbox32(multrote9db, "M1");
 
   rcon = 0x01;
   printf("int xrcon[30] = {");
@@ -172,5 +369,21 @@ int main()
   printbox8(sbox, "xS");
   printbox8(sibox, "xSi");
 
+  printbox32(subst2113, "T0");
+  printbox32(substlast, "T0L");
+  printbox32(substie9db, "T1");
+  printbox32(substilast, "T1L");
+  printbox32c(subst2113, "T0C");
+  printbox32c(substie9db, "T1C");
+
+  if (makevp() != 0) {
+    return 1;
+  }
+  printvp(vpin, "VPin");
+  printvp(vpdin, "VPdin");
+  printvp(vpinv, "VPinv");
+  printvp(vpout, "VPout");
+  printvp(vpdout, "VPdout");
+
   return 0;
 }
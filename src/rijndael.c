@@ -1,5 +1,20 @@
 /* Copyright (C) 2022 Komeil Majidi.*/
+#include <stdlib.h>
+#include <string.h>
+
 #include "rijndael.h"
+#ifdef HAVE_LIBPTHREAD
+#include <pthread.h>
+#endif
+
+#ifdef XRIJNDAEL_X86
+#include <immintrin.h>
+
+#define XSSSE3 __attribute__((target("ssse3")))
+#define XAVX2 __attribute__((target("avx2")))
+#define XAESNI __attribute__((target("aes,ssse3")))
+#endif
+
 static int xshifts[3][2][4] = {
   {{0, 1, 2, 3},
    {0, 3, 2, 1}},
@@ -69,7 +84,7 @@ static inline void xSubstitution(xword32 a[MAXBC], xword8 box[256], int BC)
 #endif	
 
 static inline void xShiftSubst(xword32 res[MAXBC], xword32 a[MAXBC],
-			int shift[4], int BC, xword8 box[256])
+			const int shift[4], int BC, xword8 box[256])
 {
   int i, j;
   int s;
@@ -169,7 +184,462 @@ static inline void xAddInvMix(xword32 res[MAXBC], xword32 a[MAXBC],
 
 #endif				/* code included for reference */
 
-int xrijndaelKeySched(xword32 key[], int keyBits, int blockBits,
+/* ---------------------------------------------------------------------- */
+/* Kernels specialized for one geometry. The algorithm is the same for
+   all of them, but BC, ROUNDS and the shift offsets are compile-time
+   constants, and the rounds are unrolled, so that the compiler can
+   fold the loops and indices above. ROUNDS only depends on the larger
+   of BC and KC, so the nine (BC, KC) pairs share six kernels. */
+
+#define XENCROUND(BC, r)				\
+  xShiftSubst(block2, block, shift, BC, xS);		\
+  xMixAdd(block, block2, rp + (r) * BC, BC);
+
+#define XDECROUND(BC, r)				\
+  xKeyAddition(block, block, rp + (r) * BC, BC);	\
+  xInvMixColumn(block2, block, BC);			\
+  xShiftSubst(block, block2, shift, BC, xSi);
+
+/* rounds 1 to ROUNDS-1, in increasing order for encryption */
+#define XENCROUNDS(BC, ROUNDS)					\
+  XENCROUND(BC, 1) XENCROUND(BC, 2) XENCROUND(BC, 3)		\
+  XENCROUND(BC, 4) XENCROUND(BC, 5) XENCROUND(BC, 6)		\
+  XENCROUND(BC, 7) XENCROUND(BC, 8) XENCROUND(BC, 9)		\
+  if (ROUNDS > 10) { XENCROUND(BC, 10) XENCROUND(BC, 11) }	\
+  if (ROUNDS > 12) { XENCROUND(BC, 12) XENCROUND(BC, 13) }
+
+/* rounds ROUNDS-1 down to 1, for decryption */
+#define XDECROUNDS(BC, ROUNDS)					\
+  if (ROUNDS > 12) { XDECROUND(BC, 13) XDECROUND(BC, 12) }	\
+  if (ROUNDS > 10) { XDECROUND(BC, 11) XDECROUND(BC, 10) }	\
+  XDECROUND(BC, 9) XDECROUND(BC, 8) XDECROUND(BC, 7)		\
+  XDECROUND(BC, 6) XDECROUND(BC, 5) XDECROUND(BC, 4)		\
+  XDECROUND(BC, 3) XDECROUND(BC, 2) XDECROUND(BC, 1)
+
+/* define xrijndaelEncrypt<BC>r<ROUNDS> and xrijndaelDecrypt<BC>r<ROUNDS>.
+   S1, S2, S3 are the encryption shifts of rows 1 to 3; decryption
+   shifts by BC-S in the same rows. */
+#define XKERNEL(BC, ROUNDS, S1, S2, S3)					\
+static void xrijndaelEncrypt##BC##r##ROUNDS(xword32 block[], roundkey *rkk) \
+{									\
+  static const int shift[4] = {0, S1, S2, S3};				\
+  xword32 block2[MAXBC];	/* hold intermediate result */		\
+  xword32 *rp = rkk->rk;						\
+									\
+  /* begin with a key addition */					\
+  xKeyAddition(block, block, rp, BC);					\
+									\
+  /* ROUNDS-1 ordinary rounds */					\
+  XENCROUNDS(BC, ROUNDS)						\
+									\
+  /* Last round is special: there is no xMixColumn */			\
+  xShiftSubst(block2, block, shift, BC, xS);				\
+  xKeyAddition(block, block2, rp + ROUNDS * BC, BC);			\
+}									\
+									\
+static void xrijndaelDecrypt##BC##r##ROUNDS(xword32 block[], roundkey *rkk) \
+{									\
+  static const int shift[4] = {0, BC - S1, BC - S2, BC - S3};		\
+  xword32 block2[MAXBC];	/* hold intermediate result */		\
+  xword32 *rp = rkk->rk;						\
+									\
+  /* First the special round:						\
+   *   without xInvMixColumn						\
+   *   with extra xKeyAddition						\
+   */									\
+  xKeyAddition(block2, block, rp + ROUNDS * BC, BC);			\
+  xShiftSubst(block, block2, shift, BC, xSi);				\
+									\
+  /* ROUNDS-1 ordinary rounds */					\
+  XDECROUNDS(BC, ROUNDS)						\
+									\
+  /* End with the extra key addition */					\
+  xKeyAddition(block, block, rp, BC);					\
+}
+
+XKERNEL(4, 10, 1, 2, 3)
+XKERNEL(4, 12, 1, 2, 3)
+XKERNEL(4, 14, 1, 2, 3)
+XKERNEL(6, 12, 1, 2, 3)
+XKERNEL(6, 14, 1, 2, 3)
+XKERNEL(8, 14, 1, 3, 4)
+
+/* kernels indexed by [(BC-4)/2][(KC-4)/2] */
+static xrijndaelkernel *xencrypt_kernels[3][3] = {
+  {xrijndaelEncrypt4r10, xrijndaelEncrypt4r12, xrijndaelEncrypt4r14},
+  {xrijndaelEncrypt6r12, xrijndaelEncrypt6r12, xrijndaelEncrypt6r14},
+  {xrijndaelEncrypt8r14, xrijndaelEncrypt8r14, xrijndaelEncrypt8r14},
+};
+
+static xrijndaelkernel *xdecrypt_kernels[3][3] = {
+  {xrijndaelDecrypt4r10, xrijndaelDecrypt4r12, xrijndaelDecrypt4r14},
+  {xrijndaelDecrypt6r12, xrijndaelDecrypt6r12, xrijndaelDecrypt6r14},
+  {xrijndaelDecrypt8r14, xrijndaelDecrypt8r14, xrijndaelDecrypt8r14},
+};
+
+/* ---------------------------------------------------------------------- */
+/* Word-oriented kernel for 256-bit blocks. The state is kept in eight
+   words; ShiftRows is folded into the choice of the source column, and
+   the S-box and MixColumn are combined in the tables T0, so that no
+   byte is written back to memory between rounds. The last round uses
+   T0L, which holds the S-box without MixColumn. Tables are indexed by
+   bytes in memory order, so the result does not depend on the
+   endianness of the host. */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define XBYTE(w, k)	((xword8)((w) >> (24 - 8 * (k))))
+#else
+#define XBYTE(w, k)	((xword8)((w) >> (8 * (k))))
+#endif
+
+/* one column: row i is taken from column ji, for shifts {0, 1, 3, 4} */
+#define XTCOL(T, s, j0, j1, j2, j3)					\
+  (T[0][XBYTE(s[j0], 0)].w32 ^ T[1][XBYTE(s[j1], 1)].w32 ^		\
+   T[2][XBYTE(s[j2], 2)].w32 ^ T[3][XBYTE(s[j3], 3)].w32)
+
+/* one round; COL is the column macro for the table layout of T */
+#define XTROUND(COL, T, d, s, rp)				\
+  d[0] = COL(T, s, 0, 1, 3, 4) ^ (rp)[0];			\
+  d[1] = COL(T, s, 1, 2, 4, 5) ^ (rp)[1];			\
+  d[2] = COL(T, s, 2, 3, 5, 6) ^ (rp)[2];			\
+  d[3] = COL(T, s, 3, 4, 6, 7) ^ (rp)[3];			\
+  d[4] = COL(T, s, 4, 5, 7, 0) ^ (rp)[4];			\
+  d[5] = COL(T, s, 5, 6, 0, 1) ^ (rp)[5];			\
+  d[6] = COL(T, s, 6, 7, 1, 2) ^ (rp)[6];			\
+  d[7] = COL(T, s, 7, 0, 2, 3) ^ (rp)[7];
+
+static void xrijndaelEncrypt8T(xword32 block[], roundkey *rkk)
+{
+  xword32 s[8], t[8];
+  xword32 *rp = rkk->rk;
+  int j;
+
+  for (j = 0; j < 8; j++) {
+    s[j] = block[j] ^ rp[j];
+  }
+
+  /* 13 ordinary rounds, alternating between s and t */
+  XTROUND(XTCOL, T0, t, s, rp + 8);
+  XTROUND(XTCOL, T0, s, t, rp + 16);
+  XTROUND(XTCOL, T0, t, s, rp + 24);
+  XTROUND(XTCOL, T0, s, t, rp + 32);
+  XTROUND(XTCOL, T0, t, s, rp + 40);
+  XTROUND(XTCOL, T0, s, t, rp + 48);
+  XTROUND(XTCOL, T0, t, s, rp + 56);
+  XTROUND(XTCOL, T0, s, t, rp + 64);
+  XTROUND(XTCOL, T0, t, s, rp + 72);
+  XTROUND(XTCOL, T0, s, t, rp + 80);
+  XTROUND(XTCOL, T0, t, s, rp + 88);
+  XTROUND(XTCOL, T0, s, t, rp + 96);
+  XTROUND(XTCOL, T0, t, s, rp + 104);
+
+  /* last round, without MixColumn */
+  XTROUND(XTCOL, T0L, s, t, rp + 112);
+
+  for (j = 0; j < 8; j++) {
+    block[j] = s[j];
+  }
+}
+
+/* Decryption with the equivalent inverse cipher: InvShiftRow,
+   InvSubstitution and InvMixColumn are combined in the tables T1, and
+   the inner round keys in rkk->drk carry InvMixColumn (see
+   xDecryptKeys). Row i is taken from column j - shift[i], with shifts
+   {0, 1, 3, 4}. */
+#define XTDROUND(COL, T, d, s, rp)				\
+  d[0] = COL(T, s, 0, 7, 5, 4) ^ (rp)[0];			\
+  d[1] = COL(T, s, 1, 0, 6, 5) ^ (rp)[1];			\
+  d[2] = COL(T, s, 2, 1, 7, 6) ^ (rp)[2];			\
+  d[3] = COL(T, s, 3, 2, 0, 7) ^ (rp)[3];			\
+  d[4] = COL(T, s, 4, 3, 1, 0) ^ (rp)[4];			\
+  d[5] = COL(T, s, 5, 4, 2, 1) ^ (rp)[5];			\
+  d[6] = COL(T, s, 6, 5, 3, 2) ^ (rp)[6];			\
+  d[7] = COL(T, s, 7, 6, 4, 3) ^ (rp)[7];
+
+static void xrijndaelDecrypt8T(xword32 block[], roundkey *rkk)
+{
+  xword32 s[8], t[8];
+  xword32 *rp = rkk->drk;
+  int j;
+
+  for (j = 0; j < 8; j++) {
+    s[j] = block[j] ^ rp[112 + j];
+  }
+
+  /* 13 ordinary rounds, alternating between s and t */
+  XTDROUND(XTCOL, T1, t, s, rp + 104);
+  XTDROUND(XTCOL, T1, s, t, rp + 96);
+  XTDROUND(XTCOL, T1, t, s, rp + 88);
+  XTDROUND(XTCOL, T1, s, t, rp + 80);
+  XTDROUND(XTCOL, T1, t, s, rp + 72);
+  XTDROUND(XTCOL, T1, s, t, rp + 64);
+  XTDROUND(XTCOL, T1, t, s, rp + 56);
+  XTDROUND(XTCOL, T1, s, t, rp + 48);
+  XTDROUND(XTCOL, T1, t, s, rp + 40);
+  XTDROUND(XTCOL, T1, s, t, rp + 32);
+  XTDROUND(XTCOL, T1, t, s, rp + 24);
+  XTDROUND(XTCOL, T1, s, t, rp + 16);
+  XTDROUND(XTCOL, T1, t, s, rp + 8);
+
+  /* last round, without InvMixColumn */
+  XTDROUND(XTCOL, T1L, s, t, rp);
+
+  for (j = 0; j < 8; j++) {
+    block[j] = s[j];
+  }
+}
+
+/* Decryption keys for the equivalent inverse cipher: the inner round
+   keys of a 256-bit key schedule with InvMixColumn applied. */
+static void xDecryptKeys(roundkey *rkk)
+{
+  int j;
+
+  for (j = 0; j < 120; j++) {
+    if (j < 8 || j >= 112) {
+      rkk->drk[j] = rkk->rk[j];
+    } else {
+      rkk->drk[j] = M1[0][XBYTE(rkk->rk[j], 0)].w32
+	^ M1[1][XBYTE(rkk->rk[j], 1)].w32
+	^ M1[2][XBYTE(rkk->rk[j], 2)].w32
+	^ M1[3][XBYTE(rkk->rk[j], 3)].w32;
+    }
+  }
+}
+
+/* The same with the compact layout: a single table T0C or T1C, whose
+   word for row i is rotated into place, and byte S-boxes in the last
+   round. This uses 1 KB of table per direction instead of 8 KB. */
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define XROT(w, k)							\
+  ((k) ? ((w) >> (8 * (k))) | ((w) << (32 - 8 * (k))) : (w))
+#define XPLACE(b, k)	((xword32)(b) << (24 - 8 * (k)))
+#else
+#define XROT(w, k)							\
+  ((k) ? ((w) << (8 * (k))) | ((w) >> (32 - 8 * (k))) : (w))
+#define XPLACE(b, k)	((xword32)(b) << (8 * (k)))
+#endif
+
+#define XTCOLC(T, s, j0, j1, j2, j3)					\
+  (T[XBYTE(s[j0], 0)].w32 ^ XROT(T[XBYTE(s[j1], 1)].w32, 1) ^		\
+   XROT(T[XBYTE(s[j2], 2)].w32, 2) ^ XROT(T[XBYTE(s[j3], 3)].w32, 3))
+
+#define XTCOLS(S, s, j0, j1, j2, j3)				\
+  (XPLACE(S[XBYTE(s[j0], 0)], 0) | XPLACE(S[XBYTE(s[j1], 1)], 1) |	\
+   XPLACE(S[XBYTE(s[j2], 2)], 2) | XPLACE(S[XBYTE(s[j3], 3)], 3))
+
+static void xrijndaelEncrypt8C(xword32 block[], roundkey *rkk)
+{
+  xword32 s[8], t[8];
+  xword32 *rp = rkk->rk;
+  int j, r;
+
+  for (j = 0; j < 8; j++) {
+    s[j] = block[j] ^ rp[j];
+  }
+  for (r = 1; r < 13; r += 2) {
+    XTROUND(XTCOLC, T0C, t, s, rp + 8 * r);
+    XTROUND(XTCOLC, T0C, s, t, rp + 8 * r + 8);
+  }
+  XTROUND(XTCOLC, T0C, t, s, rp + 104);
+  XTROUND(XTCOLS, xS, s, t, rp + 112);
+  for (j = 0; j < 8; j++) {
+    block[j] = s[j];
+  }
+}
+
+static void xrijndaelDecrypt8C(xword32 block[], roundkey *rkk)
+{
+  xword32 s[8], t[8];
+  xword32 *rp = rkk->drk;
+  int j, r;
+
+  for (j = 0; j < 8; j++) {
+    s[j] = block[j] ^ rp[112 + j];
+  }
+  for (r = 13; r > 1; r -= 2) {
+    XTDROUND(XTCOLC, T1C, t, s, rp + 8 * r);
+    XTDROUND(XTCOLC, T1C, s, t, rp + 8 * r - 8);
+  }
+  XTDROUND(XTCOLC, T1C, t, s, rp + 8);
+  XTDROUND(XTCOLS, xSi, s, t, rp);
+  for (j = 0; j < 8; j++) {
+    block[j] = s[j];
+  }
+}
+
+/* AES-NI kernel for 256-bit blocks. The state is held as two 128-bit
+   halves (columns 0-3 and 4-7), each run through the AES round
+   instructions. Before each round the bytes that ShiftRows moves
+   between the halves are exchanged, and each half is permuted so that
+   the 128-bit ShiftRows of the instruction completes the 256-bit one.
+   Decryption uses the equivalent inverse cipher, with the keys in
+   rkk->drk. */
+
+#ifdef XRIJNDAEL_X86
+
+/* bytes exchanged between the halves, and the permutation applied
+   within each half; [0] is for encryption, [1] for decryption */
+static const xword8 xaesniMask[2][16] = {
+  {0, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 255},
+  {0, 0, 0, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255},
+};
+
+static const xword8 xaesniPerm[2][16] = {
+  {0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13, 2, 3},
+  {0, 1, 14, 15, 4, 5, 2, 3, 8, 9, 6, 7, 12, 13, 10, 11},
+};
+
+#define XAESNISHIFT(lo, hi, mask, perm)				\
+  do {								\
+    __m128i d_ = _mm_and_si128(_mm_xor_si128(lo, hi), mask);	\
+    lo = _mm_shuffle_epi8(_mm_xor_si128(lo, d_), perm);		\
+    hi = _mm_shuffle_epi8(_mm_xor_si128(hi, d_), perm);		\
+  } while (0)
+
+#define XAESNIKEY(rp, r, h) _mm_loadu_si128((const __m128i *)((rp) + 8 * (r) + 4 * (h)))
+
+static XAESNI void xrijndaelEncryptAESNI(xword32 block[], roundkey *rkk)
+{
+  const xword32 *rp = rkk->rk;
+  __m128i mask = _mm_loadu_si128((const __m128i *)xaesniMask[0]);
+  __m128i perm = _mm_loadu_si128((const __m128i *)xaesniPerm[0]);
+  __m128i lo = _mm_loadu_si128((const __m128i *)block);
+  __m128i hi = _mm_loadu_si128((const __m128i *)(block + 4));
+  int r;
+
+  lo = _mm_xor_si128(lo, XAESNIKEY(rp, 0, 0));
+  hi = _mm_xor_si128(hi, XAESNIKEY(rp, 0, 1));
+  for (r = 1; r < 14; r++) {
+    XAESNISHIFT(lo, hi, mask, perm);
+    lo = _mm_aesenc_si128(lo, XAESNIKEY(rp, r, 0));
+    hi = _mm_aesenc_si128(hi, XAESNIKEY(rp, r, 1));
+  }
+  XAESNISHIFT(lo, hi, mask, perm);
+  lo = _mm_aesenclast_si128(lo, XAESNIKEY(rp, 14, 0));
+  hi = _mm_aesenclast_si128(hi, XAESNIKEY(rp, 14, 1));
+  _mm_storeu_si128((__m128i *)block, lo);
+  _mm_storeu_si128((__m128i *)(block + 4), hi);
+}
+
+static XAESNI void xrijndaelDecryptAESNI(xword32 block[], roundkey *rkk)
+{
+  const xword32 *rp = rkk->drk;
+  __m128i mask = _mm_loadu_si128((const __m128i *)xaesniMask[1]);
+  __m128i perm = _mm_loadu_si128((const __m128i *)xaesniPerm[1]);
+  __m128i lo = _mm_loadu_si128((const __m128i *)block);
+  __m128i hi = _mm_loadu_si128((const __m128i *)(block + 4));
+  int r;
+
+  lo = _mm_xor_si128(lo, XAESNIKEY(rp, 14, 0));
+  hi = _mm_xor_si128(hi, XAESNIKEY(rp, 14, 1));
+  for (r = 13; r > 0; r--) {
+    XAESNISHIFT(lo, hi, mask, perm);
+    lo = _mm_aesdec_si128(lo, XAESNIKEY(rp, r, 0));
+    hi = _mm_aesdec_si128(hi, XAESNIKEY(rp, r, 1));
+  }
+  XAESNISHIFT(lo, hi, mask, perm);
+  lo = _mm_aesdeclast_si128(lo, XAESNIKEY(rp, 0, 0));
+  hi = _mm_aesdeclast_si128(hi, XAESNIKEY(rp, 0, 1));
+  _mm_storeu_si128((__m128i *)block, lo);
+  _mm_storeu_si128((__m128i *)(block + 4), hi);
+}
+
+/* The same, for n blocks with the conventions of xrijndaelEncryptBlocks.
+   Up to XAESNIGROUP blocks are processed round by round, so that the
+   AES unit has independent instructions to pipeline. */
+#define XAESNIGROUP 4
+
+static XAESNI void xrijndaelEncryptAESNIn(xword32 block[], int n,
+					  roundkey *rkk[], int step)
+{
+  __m128i mask = _mm_loadu_si128((const __m128i *)xaesniMask[0]);
+  __m128i perm = _mm_loadu_si128((const __m128i *)xaesniPerm[0]);
+  __m128i lo[XAESNIGROUP], hi[XAESNIGROUP];
+  int m, b, r;
+
+  for (; n > 0; n -= m, block += 8 * m, rkk += step * m) {
+    m = n < XAESNIGROUP ? n : XAESNIGROUP;
+    for (b = 0; b < m; b++) {
+      lo[b] = _mm_loadu_si128((const __m128i *)(block + 8 * b));
+      hi[b] = _mm_loadu_si128((const __m128i *)(block + 8 * b + 4));
+      lo[b] = _mm_xor_si128(lo[b], XAESNIKEY(rkk[step * b]->rk, 0, 0));
+      hi[b] = _mm_xor_si128(hi[b], XAESNIKEY(rkk[step * b]->rk, 0, 1));
+    }
+    for (r = 1; r < 14; r++) {
+      for (b = 0; b < m; b++) {
+	XAESNISHIFT(lo[b], hi[b], mask, perm);
+	lo[b] = _mm_aesenc_si128(lo[b], XAESNIKEY(rkk[step * b]->rk, r, 0));
+	hi[b] = _mm_aesenc_si128(hi[b], XAESNIKEY(rkk[step * b]->rk, r, 1));
+      }
+    }
+    for (b = 0; b < m; b++) {
+      XAESNISHIFT(lo[b], hi[b], mask, perm);
+      lo[b] = _mm_aesenclast_si128(lo[b], XAESNIKEY(rkk[step * b]->rk, 14, 0));
+      hi[b] = _mm_aesenclast_si128(hi[b], XAESNIKEY(rkk[step * b]->rk, 14, 1));
+      _mm_storeu_si128((__m128i *)(block + 8 * b), lo[b]);
+      _mm_storeu_si128((__m128i *)(block + 8 * b + 4), hi[b]);
+    }
+  }
+}
+
+static XAESNI void xrijndaelDecryptAESNIn(xword32 block[], int n,
+					  roundkey *rkk[], int step)
+{
+  __m128i mask = _mm_loadu_si128((const __m128i *)xaesniMask[1]);
+  __m128i perm = _mm_loadu_si128((const __m128i *)xaesniPerm[1]);
+  __m128i lo[XAESNIGROUP], hi[XAESNIGROUP];
+  int m, b, r;
+
+  for (; n > 0; n -= m, block += 8 * m, rkk += step * m) {
+    m = n < XAESNIGROUP ? n : XAESNIGROUP;
+    for (b = 0; b < m; b++) {
+      lo[b] = _mm_loadu_si128((const __m128i *)(block + 8 * b));
+      hi[b] = _mm_loadu_si128((const __m128i *)(block + 8 * b + 4));
+      lo[b] = _mm_xor_si128(lo[b], XAESNIKEY(rkk[step * b]->drk, 14, 0));
+      hi[b] = _mm_xor_si128(hi[b], XAESNIKEY(rkk[step * b]->drk, 14, 1));
+    }
+    for (r = 13; r > 0; r--) {
+      for (b = 0; b < m; b++) {
+	XAESNISHIFT(lo[b], hi[b], mask, perm);
+	lo[b] = _mm_aesdec_si128(lo[b], XAESNIKEY(rkk[step * b]->drk, r, 0));
+	hi[b] = _mm_aesdec_si128(hi[b], XAESNIKEY(rkk[step * b]->drk, r, 1));
+      }
+    }
+    for (b = 0; b < m; b++) {
+      XAESNISHIFT(lo[b], hi[b], mask, perm);
+      lo[b] = _mm_aesdeclast_si128(lo[b], XAESNIKEY(rkk[step * b]->drk, 0, 0));
+      hi[b] = _mm_aesdeclast_si128(hi[b], XAESNIKEY(rkk[step * b]->drk, 0, 1));
+      _mm_storeu_si128((__m128i *)(block + 8 * b), lo[b]);
+      _mm_storeu_si128((__m128i *)(block + 8 * b + 4), hi[b]);
+    }
+  }
+}
+
+/* Decryption keys for the equivalent inverse cipher: InvMixColumn
+   applied to the inner round keys. */
+static XAESNI void xaesniDecryptKeys(roundkey *rkk)
+{
+  int r, h;
+
+  for (r = 0; r <= 14; r++) {
+    for (h = 0; h < 2; h++) {
+      __m128i k = XAESNIKEY(rkk->rk, r, h);
+
+      if (r > 0 && r < 14) {
+	k = _mm_aesimc_si128(k);
+      }
+      _mm_storeu_si128((__m128i *)(rkk->drk + 8 * r + 4 * h), k);
+    }
+  }
+}
+
+#endif				/* XRIJNDAEL_X86 */
+
+/* Expand the key and select the generic kernels for the geometry. key
+   is overwritten. */
+static int xKeyExpand(xword32 key[], int keyBits, int blockBits,
 		      roundkey *rkk)
 {
   /* Calculate the necessary round keys
@@ -250,64 +720,1233 @@ int xrijndaelKeySched(xword32 key[], int keyBits, int blockBits,
       rkk->shift[i][j] = xshifts[(BC - 4) >> 1][i][j];
     }
   }
+  rkk->encrypt = xencrypt_kernels[(BC - 4) >> 1][(KC - 4) >> 1];
+  rkk->decrypt = xdecrypt_kernels[(BC - 4) >> 1][(KC - 4) >> 1];
 
   return 0;
 }
 
-/* Encryption of one block. */
+/* Key expansion for 256-bit keys and blocks, equivalent to xKeyExpand
+   without the general indexing. key is not modified. Every eighth word
+   takes the rotated and substituted previous word and a round
+   constant, every eighth word at offset 4 the substituted one. */
+static void xKeyExpand256(const xword32 key[8], xword32 rk[])
+{
+  xword8x4 t, u;
+  int j;
 
-void xrijndaelEncrypt(xword32 block[], roundkey *rkk)
+  for (j = 0; j < 8; j++) {
+    rk[j] = key[j];
+  }
+  for (j = 8; j < 120; j++) {
+    t.w32 = rk[j - 1];
+    if (j % 8 == 0) {
+      u.w8[0] = xS[t.w8[1]] ^ xrcon[j / 8 - 1];
+      u.w8[1] = xS[t.w8[2]];
+      u.w8[2] = xS[t.w8[3]];
+      u.w8[3] = xS[t.w8[0]];
+      t = u;
+    } else if (j % 8 == 4) {
+      t.w8[0] = xS[t.w8[0]];
+      t.w8[1] = xS[t.w8[1]];
+      t.w8[2] = xS[t.w8[2]];
+      t.w8[3] = xS[t.w8[3]];
+    }
+    rk[j] = rk[j - 8] ^ t.w32;
+  }
+}
+
+#ifdef XRIJNDAEL_X86
+
+/* The same with AESKEYGENASSIST, which computes the substituted (and
+   rotated) words, on the two 128-bit halves of each 256-bit step. */
+static inline XAESNI __m128i xaesniPrefix(__m128i k)
 {
-  xword32 block2[MAXBC];		/* hold intermediate result */
-  int r;
+  __m128i t = _mm_slli_si128(k, 4);
 
-  int *shift = rkk->shift[0];
-  int BC = rkk->BC;
-  int ROUNDS = rkk->ROUNDS;
-  xword32 *rp = rkk->rk;
+  k = _mm_xor_si128(k, t);
+  t = _mm_slli_si128(t, 4);
+  k = _mm_xor_si128(k, t);
+  t = _mm_slli_si128(t, 4);
+  return _mm_xor_si128(k, t);
+}
 
-  /* begin with a key addition */
-  xKeyAddition(block, block, rp, BC);
-  rp += BC;
+#define XAESNIEXPAND(rk, i, rcon)					\
+  do {									\
+    __m128i t_;								\
+    t_ = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(k1, rcon), 0xff);	\
+    k0 = _mm_xor_si128(xaesniPrefix(k0), t_);				\
+    t_ = _mm_shuffle_epi32(_mm_aeskeygenassist_si128(k0, 0), 0xaa);	\
+    k1 = _mm_xor_si128(xaesniPrefix(k1), t_);				\
+    _mm_storeu_si128((__m128i *)((rk) + 8 * (i)), k0);			\
+    _mm_storeu_si128((__m128i *)((rk) + 8 * (i) + 4), k1);		\
+  } while (0)
 
-  /* ROUNDS-1 ordinary rounds */
-  for (r = 1; r < ROUNDS; r++) {
-    xShiftSubst(block2, block, shift, BC, xS);
-    xMixAdd(block, block2, rp, BC);
-    rp += BC;
+static XAESNI void xKeyExpand256AESNI(const xword32 key[8], xword32 rk[])
+{
+  __m128i k0 = _mm_loadu_si128((const __m128i *)key);
+  __m128i k1 = _mm_loadu_si128((const __m128i *)(key + 4));
+
+  _mm_storeu_si128((__m128i *)rk, k0);
+  _mm_storeu_si128((__m128i *)(rk + 4), k1);
+  XAESNIEXPAND(rk, 1, 0x01);
+  XAESNIEXPAND(rk, 2, 0x02);
+  XAESNIEXPAND(rk, 3, 0x04);
+  XAESNIEXPAND(rk, 4, 0x08);
+  XAESNIEXPAND(rk, 5, 0x10);
+  XAESNIEXPAND(rk, 6, 0x20);
+  XAESNIEXPAND(rk, 7, 0x40);
+  XAESNIEXPAND(rk, 8, 0x80);
+  XAESNIEXPAND(rk, 9, 0x1b);
+  XAESNIEXPAND(rk, 10, 0x36);
+  XAESNIEXPAND(rk, 11, 0x6c);
+  XAESNIEXPAND(rk, 12, 0xd8);
+  XAESNIEXPAND(rk, 13, 0xab);
+  XAESNIEXPAND(rk, 14, 0x4d);
+}
+
+#endif				/* XRIJNDAEL_X86 */
+
+/* ---------------------------------------------------------------------- */
+/* Runtime selection of the kernels for 256-bit blocks. The candidates
+   are listed in order of measured speed on batches of blocks. Single
+   blocks, as in serial CFB encryption and header checks, use the first
+   candidate that the CPU supports and that passes a known-answer test,
+   skipping the vector-permute kernels, which are slower than the
+   T-tables there. Batches use the first candidate that passes, if it
+   is that one or a vector-permute kernel. The environment variable
+   LEANOCRYPT_KERNEL can name a candidate to use for both instead, if
+   it is supported and passes the test. */
+
+typedef struct {
+  const char *name;
+  xrijndaelkernel *encrypt;
+  xrijndaelkernel *decrypt;
+  xrijndaelbatch *encryptn;	/* n blocks */
+  xrijndaelbatch *decryptn;
+  void (*expand256)(const xword32 key[8], xword32 rk[]);
+  int (*supported)(void);
+  void (*prepare)(roundkey *rkk);	/* extra key setup, or NULL */
+  int batchonly;		/* only faster on batches */
+} xkernel;
+
+static int xhaveAny(void)
+{
+  return 1;
+}
+
+/* n blocks, one at a time, with the kernels of the keys */
+static void xEncryptLoop(xword32 block[], int n, roundkey *rkk[], int step)
+{
+  int i;
+
+  for (i = 0; i < n; i++) {
+    rkk[step * i]->encrypt(block + rkk[step * i]->BC * i, rkk[step * i]);
   }
+}
+
+static void xDecryptLoop(xword32 block[], int n, roundkey *rkk[], int step)
+{
+  int i;
 
-  /* Last round is special: there is no xMixColumn */
-  xShiftSubst(block2, block, shift, BC, xS);
-  xKeyAddition(block, block2, rp, BC);
+  for (i = 0; i < n; i++) {
+    rkk[step * i]->decrypt(block + rkk[step * i]->BC * i, rkk[step * i]);
+  }
+}
+
+#ifdef XRIJNDAEL_X86
+
+static int xhaveAESNI(void)
+{
+  return __builtin_cpu_supports("aes") && __builtin_cpu_supports("ssse3");
+}
+
+static int xhaveAVX2(void)
+{
+  return __builtin_cpu_supports("avx2");
 }
 
-void xrijndaelDecrypt(xword32 block[], roundkey *rkk)
+static int xhaveSSSE3(void)
+{
+  return __builtin_cpu_supports("ssse3");
+}
+
+/* single-block entry points of the vector-permute kernels */
+static void xrijndaelEncrypt1AVX2(xword32 block[], roundkey *rkk)
+{
+  xrijndaelEncryptAVX2(block, 1, &rkk, 0);
+}
+
+static void xrijndaelDecrypt1AVX2(xword32 block[], roundkey *rkk)
+{
+  xrijndaelDecryptAVX2(block, 1, &rkk, 0);
+}
+
+static void xrijndaelEncrypt1SSSE3(xword32 block[], roundkey *rkk)
+{
+  xrijndaelEncryptSSSE3(block, 1, &rkk, 0);
+}
+
+static void xrijndaelDecrypt1SSSE3(xword32 block[], roundkey *rkk)
+{
+  xrijndaelDecryptSSSE3(block, 1, &rkk, 0);
+}
+
+#endif				/* XRIJNDAEL_X86 */
+
+/* single-block entry points of the bitsliced kernel */
+static void xrijndaelEncrypt1BS(xword32 block[], roundkey *rkk)
+{
+  xrijndaelEncryptBS(block, 1, &rkk, 0);
+}
+
+static void xrijndaelDecrypt1BS(xword32 block[], roundkey *rkk)
+{
+  xrijndaelDecryptBS(block, 1, &rkk, 0);
+}
+
+/* the T-table kernel with the compact layout; configure
+   --enable-compact-tables prefers it to the full tables */
+#define XCOMPACT							\
+  {"compact", xrijndaelEncrypt8C, xrijndaelDecrypt8C,			\
+   xEncryptLoop, xDecryptLoop, xKeyExpand256, xhaveAny, xDecryptKeys, 0}
+
+static const xkernel xkernels[] = {
+#ifdef XRIJNDAEL_X86
+  {"aesni", xrijndaelEncryptAESNI, xrijndaelDecryptAESNI,
+   xrijndaelEncryptAESNIn, xrijndaelDecryptAESNIn, xKeyExpand256AESNI,
+   xhaveAESNI, xaesniDecryptKeys, 0},
+  {"avx2", xrijndaelEncrypt1AVX2, xrijndaelDecrypt1AVX2,
+   xrijndaelEncryptAVX2, xrijndaelDecryptAVX2, xKeyExpand256, xhaveAVX2,
+   NULL, 1},
+  {"ssse3", xrijndaelEncrypt1SSSE3, xrijndaelDecrypt1SSSE3,
+   xrijndaelEncryptSSSE3, xrijndaelDecryptSSSE3, xKeyExpand256, xhaveSSSE3,
+   NULL, 1},
+#endif
+#ifdef COMPACT_TABLES
+  XCOMPACT,
+#endif
+  {"ttable", xrijndaelEncrypt8T, xrijndaelDecrypt8T,
+   xEncryptLoop, xDecryptLoop, xKeyExpand256, xhaveAny, xDecryptKeys, 0},
+#ifndef COMPACT_TABLES
+  XCOMPACT,
+#endif
+  {"bitsliced", xrijndaelEncrypt1BS, xrijndaelDecrypt1BS,
+   xrijndaelEncryptBS, xrijndaelDecryptBS, xKeyExpand256, xhaveAny, NULL,
+   0},
+  {"generic", xrijndaelEncrypt8r14, xrijndaelDecrypt8r14,
+   xEncryptLoop, xDecryptLoop, xKeyExpand256, xhaveAny, NULL, 0},
+};
+
+#define XNKERNELS ((int) (sizeof(xkernels) / sizeof(xkernels[0])))
+
+static const xkernel *xkernel_selected = NULL;	/* single blocks */
+static const xkernel *xkernel_batch = NULL;	/* batches of blocks */
+static char xkernel_name[32];
+
+static void xKernelApply(const xkernel *k, roundkey *rkk)
+{
+  if (k->prepare) {
+    k->prepare(rkk);
+  }
+  rkk->encrypt = k->encrypt;
+  rkk->decrypt = k->decrypt;
+}
+
+/* Rijndael-256/256 with key bytes i and plaintext bytes 0x11 * i */
+static const xword8 xkat_cipher[32] = {
+  0x28, 0x8f, 0xa9, 0xd2, 0x3d, 0x00, 0xd9, 0xdc,
+  0x0a, 0x39, 0xb3, 0x3f, 0xa9, 0x28, 0x67, 0xc6,
+  0x48, 0x8b, 0x5e, 0x0f, 0x18, 0xa6, 0xf7, 0x4c,
+  0x07, 0x20, 0x78, 0xec, 0x81, 0x54, 0x62, 0xe6,
+};
+
+/* return 1 if the kernel is supported and passes the known-answer
+   test, else 0 */
+static int xKernelCheck(const xkernel *k)
+{
+  xword32 key[8], block[8], rk[120];
+  xword8 *kb = (xword8 *) key, *bb = (xword8 *) block;
+  roundkey rkk, *p = &rkk;
+  int i;
+
+  if (!k->supported()) {
+    return 0;
+  }
+  for (i = 0; i < 32; i++) {
+    kb[i] = i;
+    bb[i] = 0x11 * i;
+  }
+  k->expand256(key, rk);
+  xKeyExpand(key, 256, 256, &rkk);
+  if (memcmp(rk, rkk.rk, sizeof(rk)) != 0) {
+    return 0;
+  }
+  xKernelApply(k, &rkk);
+  rkk.encrypt(block, &rkk);
+  if (memcmp(bb, xkat_cipher, 32) != 0) {
+    return 0;
+  }
+  rkk.decrypt(block, &rkk);
+  for (i = 0; i < 32; i++) {
+    if (bb[i] != (xword8) (0x11 * i)) {
+      return 0;
+    }
+  }
+  k->encryptn(block, 1, &p, 0);
+  if (memcmp(bb, xkat_cipher, 32) != 0) {
+    return 0;
+  }
+  k->decryptn(block, 1, &p, 0);
+  for (i = 0; i < 32; i++) {
+    if (bb[i] != (xword8) (0x11 * i)) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+static void xKernelPick(void)
+{
+  const char *name;
+  int i;
+
+  name = getenv("LEANOCRYPT_KERNEL");
+  if (name) {
+    for (i = 0; i < XNKERNELS; i++) {
+      if (strcmp(name, xkernels[i].name) == 0 && xKernelCheck(&xkernels[i])) {
+	xkernel_selected = xkernel_batch = &xkernels[i];
+	return;
+      }
+    }
+  }
+  for (i = 0; i < XNKERNELS; i++) {
+    if (!xkernels[i].batchonly && xKernelCheck(&xkernels[i])) {
+      xkernel_selected = &xkernels[i];
+      break;
+    }
+  }
+  if (!xkernel_selected) {
+    /* not reached: the generic kernel always passes */
+    xkernel_selected = &xkernels[XNKERNELS - 1];
+  }
+  /* the vector-permute kernels need no key setup of their own, so they
+     can share the round keys prepared for the single-block kernel */
+  for (i = 0; &xkernels[i] != xkernel_selected; i++) {
+    if (xkernels[i].batchonly && xKernelCheck(&xkernels[i])) {
+      break;
+    }
+  }
+  xkernel_batch = &xkernels[i];
+}
+
+static void xKernelInit(void)
+{
+  xKernelPick();
+  strcpy(xkernel_name, xkernel_selected->name);
+  if (xkernel_batch != xkernel_selected) {
+    strcat(xkernel_name, "/");
+    strcat(xkernel_name, xkernel_batch->name);
+  }
+}
+
+/* the kernel is selected once, even if several threads schedule keys
+   at the same time */
+static const xkernel *xKernelSelect(void)
+{
+#ifdef HAVE_LIBPTHREAD
+  static pthread_once_t once = PTHREAD_ONCE_INIT;
+
+  pthread_once(&once, xKernelInit);
+#else
+  if (!xkernel_selected) {
+    xKernelInit();
+  }
+#endif
+  return xkernel_selected;
+}
+
+const char *xrijndaelKernel(void)
+{
+  xKernelSelect();
+  return xkernel_name;
+}
+
+/* the kernel for batches of blocks */
+static const xkernel *xKernelBatch(void)
+{
+  xKernelSelect();
+  return xkernel_batch;
+}
+
+int xrijndaelKeySched(xword32 key[], int keyBits, int blockBits,
+		      roundkey *rkk)
 {
-  xword32 block2[MAXBC];		/* hold intermediate result */
   int r;
 
-  int *shift = rkk->shift[1];
-  int BC = rkk->BC;
-  int ROUNDS = rkk->ROUNDS;
-  xword32 *rp = rkk->rk + ROUNDS * BC;
-  /* First the special round:
-   *   without xInvMixColumn
-   *   with extra xKeyAddition
-   */
-  xKeyAddition(block2, block, rp, BC);
-  xShiftSubst(block, block2, shift, BC, xSi);
-  rp -= BC;
+  r = xKeyExpand(key, keyBits, blockBits, rkk);
+  if (r == 0 && rkk->BC == 8) {
+    xKernelApply(xKernelSelect(), rkk);
+  }
+  return r;
+}
 
-  /* ROUNDS-1 ordinary rounds
-   */
-  for (r = ROUNDS - 1; r > 0; r--) {
-    xKeyAddition(block, block, rp, BC);
-    xInvMixColumn(block2, block, BC);
-    xShiftSubst(block, block2, shift, BC, xSi);
-    rp -= BC;
+void xrijndaelKeySched256(const xword32 key[8], roundkey *rkk)
+{
+  xrijndaelKeySched256n((xword32 (*)[8]) key, 1, rkk);
+}
+
+void xrijndaelKeySched256n(xword32 key[][8], int n, roundkey rkk[])
+{
+  const xkernel *k = xKernelSelect();
+  int i, j;
+
+  for (i = 0; i < n; i++) {
+    k->expand256(key[i], rkk[i].rk);
+    rkk[i].BC = 8;
+    rkk[i].KC = 8;
+    rkk[i].ROUNDS = 14;
+    for (j = 0; j < 4; j++) {
+      rkk[i].shift[0][j] = xshifts[2][0][j];
+      rkk[i].shift[1][j] = xshifts[2][1][j];
+    }
+    xKernelApply(k, &rkk[i]);
   }
-  /* End with the extra key addition
-   */
-  xKeyAddition(block, block, rp, BC);
 }
+
+void xrijndaelEncryptBlocks(xword32 block[], int n, roundkey *rkk[],
+			    int step)
+{
+  if (n > 0 && rkk[0]->BC == 8) {
+    xKernelBatch()->encryptn(block, n, rkk, step);
+  } else {
+    xEncryptLoop(block, n, rkk, step);
+  }
+}
+
+void xrijndaelDecryptBlocks(xword32 block[], int n, roundkey *rkk[],
+			    int step)
+{
+  if (n > 0 && rkk[0]->BC == 8) {
+    xKernelBatch()->decryptn(block, n, rkk, step);
+  } else {
+    xDecryptLoop(block, n, rkk, step);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+/* Bitsliced kernel for 256-bit blocks, XBSLANES blocks at a time. The
+   state is held in 32 words q[8 * i + b]: bit 8 * j + l of that word is
+   bit b of the byte in row i, column j of block l. ShiftRows is then a
+   rotation of each word by whole bytes, MixColumn combines the words
+   of different rows, and the S-box is a boolean circuit evaluated on
+   the 8 bit planes of a row. */
+
+/* transpose an 8x8 bit matrix: bit 8 * i + j moves to 8 * j + i */
+static inline xword64 xbsTranspose(xword64 x)
+{
+  xword64 t;
+
+  t = (x ^ (x >> 7)) & 0x00aa00aa00aa00aaULL;
+  x ^= t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000cccc0000ccccULL;
+  x ^= t ^ (t << 14);
+  t = (x ^ (x >> 28)) & 0x00000000f0f0f0f0ULL;
+  x ^= t ^ (t << 28);
+  return x;
+}
+
+/* convert XBSLANES blocks of 32 bytes to bitsliced form */
+static void xbsPack(xword64 q[32], const xword8 *p[XBSLANES])
+{
+  int i, j, b, l;
+  xword64 x;
+
+  for (i = 0; i < 32; i++) {
+    q[i] = 0;
+  }
+  for (i = 0; i < 4; i++) {
+    for (j = 0; j < 8; j++) {
+      x = 0;
+      for (l = 0; l < XBSLANES; l++) {
+	x |= (xword64)p[l][4 * j + i] << (8 * l);
+      }
+      x = xbsTranspose(x);
+      for (b = 0; b < 8; b++) {
+	q[8 * i + b] |= ((x >> (8 * b)) & 0xff) << (8 * j);
+      }
+    }
+  }
+}
+
+/* convert back, writing only the first n blocks */
+static void xbsUnpack(const xword64 q[32], xword8 *p[XBSLANES], int n)
+{
+  int i, j, b, l;
+  xword64 x;
+
+  for (i = 0; i < 4; i++) {
+    for (j = 0; j < 8; j++) {
+      x = 0;
+      for (b = 0; b < 8; b++) {
+	x |= ((q[8 * i + b] >> (8 * j)) & 0xff) << (8 * b);
+      }
+      x = xbsTranspose(x);
+      for (l = 0; l < n; l++) {
+	p[l][4 * j + i] = x >> (8 * l);
+      }
+    }
+  }
+}
+
+/* spread the 8 bits of m to 8 bytes of 0x00 or 0xff */
+static inline xword64 xbsSpread(xword64 m)
+{
+  m = (m | (m << 28)) & 0x0000000f0000000fULL;
+  m = (m | (m << 14)) & 0x0003000300030003ULL;
+  m = (m | (m << 7)) & 0x0101010101010101ULL;
+  return m * 0xff;
+}
+
+/* the same 32-byte round key in all lanes */
+static void xbsBroadcast(xword64 q[32], const xword32 *rk)
+{
+  const xword8 *k8 = (const xword8 *)rk;
+  int i, j, b;
+  xword64 x;
+
+  for (i = 0; i < 4; i++) {
+    x = 0;
+    for (j = 0; j < 8; j++) {
+      x |= (xword64)k8[4 * j + i] << (8 * j);
+    }
+    x = xbsTranspose(x);
+    for (b = 0; b < 8; b++) {
+      q[8 * i + b] = xbsSpread((x >> (8 * b)) & 0xff);
+    }
+  }
+}
+
+/* bitsliced round keys 0 to 14 for the lanes of the current group. With
+   step 0 they are the same for every group, and are only computed for
+   the first one. */
+static void xbsRoundKeys(xword64 k[15][32], roundkey *rkk[], int step,
+			 int first)
+{
+  const xword8 *p[XBSLANES];
+  int l, r;
+
+  for (r = 0; r < 15; r++) {
+    if (step == 0) {
+      if (first) {
+	xbsBroadcast(k[r], rkk[0]->rk + 8 * r);
+      }
+      continue;
+    }
+    for (l = 0; l < XBSLANES; l++) {
+      p[l] = (const xword8 *)(rkk[l]->rk + 8 * r);
+    }
+    xbsPack(k[r], p);
+  }
+}
+
+static inline void xbsAddKey(xword64 q[32], const xword64 k[32])
+{
+  int i;
+
+  for (i = 0; i < 32; i++) {
+    q[i] ^= k[i];
+  }
+}
+
+/* The S-box circuit of Boyar and Peralta, 113 gates. q[0] is the least
+   significant bit plane. */
+static void xbsSbox(xword64 q[8])
+{
+  xword64 x0, x1, x2, x3, x4, x5, x6, x7;
+  xword64 y1, y2, y3, y4, y5, y6, y7, y8, y9;
+  xword64 y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+  xword64 y20, y21;
+  xword64 z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+  xword64 z10, z11, z12, z13, z14, z15, z16, z17;
+  xword64 t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+  xword64 t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+  xword64 t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+  xword64 t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+  xword64 t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+  xword64 t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  xword64 t60, t61, t62, t63, t64, t65, t66, t67;
+  xword64 s0, s1, s2, s3, s4, s5, s6, s7;
+
+  x0 = q[7];
+  x1 = q[6];
+  x2 = q[5];
+  x3 = q[4];
+  x4 = q[3];
+  x5 = q[2];
+  x6 = q[1];
+  x7 = q[0];
+
+  /* top linear transformation */
+  y14 = x3 ^ x5;
+  y13 = x0 ^ x6;
+  y9 = x0 ^ x3;
+  y8 = x0 ^ x5;
+  t0 = x1 ^ x2;
+  y1 = t0 ^ x7;
+  y4 = y1 ^ x3;
+  y12 = y13 ^ y14;
+  y2 = y1 ^ x0;
+  y5 = y1 ^ x6;
+  y3 = y5 ^ y8;
+  t1 = x4 ^ y12;
+  y15 = t1 ^ x5;
+  y20 = t1 ^ x1;
+  y6 = y15 ^ x7;
+  y10 = y15 ^ t0;
+  y11 = y20 ^ y9;
+  y7 = x7 ^ y11;
+  y17 = y10 ^ y11;
+  y19 = y10 ^ y8;
+  y16 = t0 ^ y11;
+  y21 = y13 ^ y16;
+  y18 = x0 ^ y16;
+
+  /* non-linear section */
+  t2 = y12 & y15;
+  t3 = y3 & y6;
+  t4 = t3 ^ t2;
+  t5 = y4 & x7;
+  t6 = t5 ^ t2;
+  t7 = y13 & y16;
+  t8 = y5 & y1;
+  t9 = t8 ^ t7;
+  t10 = y2 & y7;
+  t11 = t10 ^ t7;
+  t12 = y9 & y11;
+  t13 = y14 & y17;
+  t14 = t13 ^ t12;
+  t15 = y8 & y10;
+  t16 = t15 ^ t12;
+  t17 = t4 ^ t14;
+  t18 = t6 ^ t16;
+  t19 = t9 ^ t14;
+  t20 = t11 ^ t16;
+  t21 = t17 ^ y20;
+  t22 = t18 ^ y19;
+  t23 = t19 ^ y21;
+  t24 = t20 ^ y18;
+
+  t25 = t21 ^ t22;
+  t26 = t21 & t23;
+  t27 = t24 ^ t26;
+  t28 = t25 & t27;
+  t29 = t28 ^ t22;
+  t30 = t23 ^ t24;
+  t31 = t22 ^ t26;
+  t32 = t31 & t30;
+  t33 = t32 ^ t24;
+  t34 = t23 ^ t33;
+  t35 = t27 ^ t33;
+  t36 = t24 & t35;
+  t37 = t36 ^ t34;
+  t38 = t27 ^ t36;
+  t39 = t29 & t38;
+  t40 = t25 ^ t39;
+
+  t41 = t40 ^ t37;
+  t42 = t29 ^ t33;
+  t43 = t29 ^ t40;
+  t44 = t33 ^ t37;
+  t45 = t42 ^ t41;
+  z0 = t44 & y15;
+  z1 = t37 & y6;
+  z2 = t33 & x7;
+  z3 = t43 & y16;
+  z4 = t40 & y1;
+  z5 = t29 & y7;
+  z6 = t42 & y11;
+  z7 = t45 & y17;
+  z8 = t41 & y10;
+  z9 = t44 & y12;
+  z10 = t37 & y3;
+  z11 = t33 & y4;
+  z12 = t43 & y13;
+  z13 = t40 & y5;
+  z14 = t29 & y2;
+  z15 = t42 & y9;
+  z16 = t45 & y14;
+  z17 = t41 & y8;
+
+  /* bottom linear transformation */
+  t46 = z15 ^ z16;
+  t47 = z10 ^ z11;
+  t48 = z5 ^ z13;
+  t49 = z9 ^ z10;
+  t50 = z2 ^ z12;
+  t51 = z2 ^ z5;
+  t52 = z7 ^ z8;
+  t53 = z0 ^ z3;
+  t54 = z6 ^ z7;
+  t55 = z16 ^ z17;
+  t56 = z12 ^ t48;
+  t57 = t50 ^ t53;
+  t58 = z4 ^ t46;
+  t59 = z3 ^ t54;
+  t60 = t46 ^ t57;
+  t61 = z14 ^ t57;
+  t62 = t52 ^ t58;
+  t63 = t49 ^ t58;
+  t64 = z4 ^ t59;
+  t65 = t61 ^ t62;
+  t66 = z1 ^ t63;
+  s0 = t59 ^ t63;
+  s6 = t56 ^ ~t62;
+  s7 = t48 ^ ~t60;
+  t67 = t64 ^ t65;
+  s3 = t53 ^ t66;
+  s4 = t51 ^ t66;
+  s5 = t47 ^ t65;
+  s1 = t64 ^ ~s3;
+  s2 = t55 ^ ~t67;
+
+  q[7] = s0;
+  q[6] = s1;
+  q[5] = s2;
+  q[4] = s3;
+  q[3] = s4;
+  q[2] = s5;
+  q[1] = s6;
+  q[0] = s7;
+}
+
+/* the inverse of the affine part of the S-box */
+static inline void xbsInvAffine(xword64 q[8])
+{
+  xword64 r[8];
+  int b;
+
+  for (b = 0; b < 8; b++) {
+    r[b] = q[(b + 7) & 7] ^ q[(b + 5) & 7] ^ q[(b + 2) & 7];
+  }
+  for (b = 0; b < 8; b++) {
+    q[b] = r[b];
+  }
+  q[0] = ~q[0];
+  q[2] = ~q[2];
+}
+
+/* inverse S-box, computed as InvAffine(Sbox(InvAffine(x))) */
+static void xbsInvSbox(xword64 q[8])
+{
+  xbsInvAffine(q);
+  xbsSbox(q);
+  xbsInvAffine(q);
+}
+
+static inline xword64 xbsRotr(xword64 x, int n)
+{
+  return n ? (x >> n) | (x << (64 - n)) : x;
+}
+
+/* rows 1 to 3 are rotated by 1, 3, and 4 columns */
+static void xbsShiftRows(xword64 q[32], int inverse)
+{
+  static const int shift[4] = {0, 1, 3, 4};
+  int i, b, s;
+
+  for (i = 1; i < 4; i++) {
+    s = inverse ? 8 - shift[i] : shift[i];
+    for (b = 0; b < 8; b++) {
+      q[8 * i + b] = xbsRotr(q[8 * i + b], 8 * s);
+    }
+  }
+}
+
+/* multiply a row by 2 in GF(2^8), modulo 0x11b */
+static inline void xbsXtime(xword64 r[8], const xword64 a[8])
+{
+  r[0] = a[7];
+  r[1] = a[0] ^ a[7];
+  r[2] = a[1];
+  r[3] = a[2] ^ a[7];
+  r[4] = a[3] ^ a[7];
+  r[5] = a[4];
+  r[6] = a[5];
+  r[7] = a[6];
+}
+
+/* row i becomes 2 a[i] + 3 a[i+1] + a[i+2] + a[i+3] */
+static void xbsMixColumn(xword64 q[32])
+{
+  xword64 a[32], t[8], m[8];
+  int i, b;
+
+  for (b = 0; b < 32; b++) {
+    a[b] = q[b];
+  }
+  for (i = 0; i < 4; i++) {
+    for (b = 0; b < 8; b++) {
+      t[b] = a[8 * i + b] ^ a[8 * ((i + 1) & 3) + b];
+    }
+    xbsXtime(m, t);
+    for (b = 0; b < 8; b++) {
+      q[8 * i + b] = m[b] ^ a[8 * ((i + 1) & 3) + b]
+	^ a[8 * ((i + 2) & 3) + b] ^ a[8 * ((i + 3) & 3) + b];
+    }
+  }
+}
+
+/* InvMixColumn is MixColumn after adding 4 (a[i] + a[i+2]) to rows i
+   and i+2 */
+static void xbsInvMixColumn(xword64 q[32])
+{
+  xword64 t[8], u[8], v[8];
+  int i, b;
+
+  for (i = 0; i < 2; i++) {
+    for (b = 0; b < 8; b++) {
+      t[b] = q[8 * i + b] ^ q[8 * (i + 2) + b];
+    }
+    xbsXtime(u, t);
+    xbsXtime(v, u);
+    for (b = 0; b < 8; b++) {
+      q[8 * i + b] ^= v[b];
+      q[8 * (i + 2) + b] ^= v[b];
+    }
+  }
+  xbsMixColumn(q);
+}
+
+static void xbsSubBytes(xword64 q[32])
+{
+  int i;
+
+  for (i = 0; i < 4; i++) {
+    xbsSbox(q + 8 * i);
+  }
+}
+
+static void xbsInvSubBytes(xword64 q[32])
+{
+  int i;
+
+  for (i = 0; i < 4; i++) {
+    xbsInvSbox(q + 8 * i);
+  }
+}
+
+/* set up the lanes of one group of at most XBSLANES blocks; unused
+   lanes repeat the first block and key */
+static void xbsLanes(xword32 block[], int n, roundkey *rkk[], int step,
+		     xword8 *p[XBSLANES], roundkey *lk[XBSLANES])
+{
+  int l;
+
+  for (l = 0; l < XBSLANES; l++) {
+    p[l] = (xword8 *)(block + 8 * (l < n ? l : 0));
+    lk[l] = rkk[step && l < n ? l : 0];
+  }
+}
+
+void xrijndaelEncryptBS(xword32 block[], int n, roundkey *rkk[], int step)
+{
+  xword64 q[32], k[15][32];
+  xword8 *p[XBSLANES];
+  roundkey *lk[XBSLANES];
+  int r, m, first;
+
+  for (first = 1; n > 0; n -= m, block += 8 * m, rkk += step * m) {
+    m = n < XBSLANES ? n : XBSLANES;
+    xbsLanes(block, m, rkk, step, p, lk);
+    xbsPack(q, (const xword8 **)p);
+    xbsRoundKeys(k, lk, step, first);
+    first = 0;
+
+    xbsAddKey(q, k[0]);
+    for (r = 1; r < 14; r++) {
+      xbsSubBytes(q);
+      xbsShiftRows(q, 0);
+      xbsMixColumn(q);
+      xbsAddKey(q, k[r]);
+    }
+    xbsSubBytes(q);
+    xbsShiftRows(q, 0);
+    xbsAddKey(q, k[14]);
+
+    xbsUnpack(q, p, m);
+  }
+}
+
+void xrijndaelDecryptBS(xword32 block[], int n, roundkey *rkk[], int step)
+{
+  xword64 q[32], k[15][32];
+  xword8 *p[XBSLANES];
+  roundkey *lk[XBSLANES];
+  int r, m, first;
+
+  for (first = 1; n > 0; n -= m, block += 8 * m, rkk += step * m) {
+    m = n < XBSLANES ? n : XBSLANES;
+    xbsLanes(block, m, rkk, step, p, lk);
+    xbsPack(q, (const xword8 **)p);
+    xbsRoundKeys(k, lk, step, first);
+    first = 0;
+
+    xbsAddKey(q, k[14]);
+    xbsShiftRows(q, 1);
+    xbsInvSubBytes(q);
+    for (r = 13; r > 0; r--) {
+      xbsAddKey(q, k[r]);
+      xbsInvMixColumn(q);
+      xbsShiftRows(q, 1);
+      xbsInvSubBytes(q);
+    }
+    xbsAddKey(q, k[0]);
+
+    xbsUnpack(q, p, m);
+  }
+}
+
+/* ---------------------------------------------------------------------- */
+/* Vector-permute kernels for 256-bit blocks. SubBytes maps each byte to
+   a representation over GF(2^4) and inverts it there with pshufb
+   lookups on nibbles; the tables VP* and their derivation are in
+   maketables.c. MixColumn is computed with byte rotations inside each
+   column and a vector xtime. A block is held as two 128-bit halves
+   (columns 0-3 and 4-7), so ShiftRows first exchanges between the
+   halves the bytes that cross over, then permutes within each half.
+   SSSE3 holds a half per register, AVX2 a whole block per register. */
+
+#ifdef XRIJNDAEL_X86
+
+/* ShiftRows: the bytes selected by xvpMask are swapped between the two
+   halves, then each half is permuted by xvpPerm. [0] is for
+   encryption, [1] for decryption. */
+static const xword8 xvpPerm[2][16] = {
+  {0, 5, 14, 3, 4, 9, 2, 7, 8, 13, 6, 11, 12, 1, 10, 15},
+  {0, 13, 6, 3, 4, 1, 10, 7, 8, 5, 14, 11, 12, 9, 2, 15},
+};
+
+static const xword8 xvpMask[2][16] = {
+  {0, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 255},
+  {0, 0, 0, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 255, 255, 255},
+};
+
+/* rotate each column by 1 and 2 rows */
+static const xword8 xvpRot[2][16] = {
+  {1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12},
+  {2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13},
+};
+
+/* 128-bit registers */
+
+typedef struct {
+  __m128i in0, in1, inv, ak, out0, out1;
+  __m128i perm, mask, rot1, rot2;
+  __m128i m0f, m1b, c63;
+} xvp128;
+
+static inline XSSSE3 __m128i xvpLoad128(const void *p)
+{
+  return _mm_loadu_si128((const __m128i *)p);
+}
+
+static XSSSE3 void xvpInit128(xvp128 *v, int dec)
+{
+  v->in0 = xvpLoad128(dec ? VPdin[0] : VPin[0]);
+  v->in1 = xvpLoad128(dec ? VPdin[1] : VPin[1]);
+  v->inv = xvpLoad128(VPinv[0]);
+  v->ak = xvpLoad128(VPinv[1]);
+  v->out0 = xvpLoad128(dec ? VPdout[0] : VPout[0]);
+  v->out1 = xvpLoad128(dec ? VPdout[1] : VPout[1]);
+  v->perm = xvpLoad128(xvpPerm[dec]);
+  v->mask = xvpLoad128(xvpMask[dec]);
+  v->rot1 = xvpLoad128(xvpRot[0]);
+  v->rot2 = xvpLoad128(xvpRot[1]);
+  v->m0f = _mm_set1_epi8(0x0f);
+  v->m1b = _mm_set1_epi8(0x1b);
+  v->c63 = _mm_set1_epi8(dec ? 0 : 0x63);
+}
+
+/* SubBytes (encryption) or InvSubBytes (decryption) */
+static inline XSSSE3 __m128i xvpSub128(const xvp128 *v, __m128i x)
+{
+  __m128i i, j, k, ak, iak, jak, io, jo;
+
+  k = _mm_and_si128(x, v->m0f);
+  i = _mm_and_si128(_mm_srli_epi16(x, 4), v->m0f);
+  x = _mm_xor_si128(_mm_shuffle_epi8(v->in0, k), _mm_shuffle_epi8(v->in1, i));
+  k = _mm_and_si128(x, v->m0f);
+  i = _mm_and_si128(_mm_srli_epi16(x, 4), v->m0f);
+  j = _mm_xor_si128(i, k);
+  ak = _mm_shuffle_epi8(v->ak, k);
+  iak = _mm_xor_si128(_mm_shuffle_epi8(v->inv, i), ak);
+  jak = _mm_xor_si128(_mm_shuffle_epi8(v->inv, j), ak);
+  io = _mm_xor_si128(_mm_shuffle_epi8(v->inv, iak), j);
+  jo = _mm_xor_si128(_mm_shuffle_epi8(v->inv, jak), i);
+  return _mm_xor_si128(_mm_shuffle_epi8(v->out0, io),
+		       _mm_shuffle_epi8(v->out1, jo));
+}
+
+static inline XSSSE3 __m128i xvpXtime128(const xvp128 *v, __m128i x)
+{
+  __m128i hi = _mm_cmpgt_epi8(_mm_setzero_si128(), x);
+
+  return _mm_xor_si128(_mm_add_epi8(x, x), _mm_and_si128(hi, v->m1b));
+}
+
+/* row i becomes 2 a[i] + 3 a[i+1] + a[i+2] + a[i+3] */
+static inline XSSSE3 __m128i xvpMix128(const xvp128 *v, __m128i a)
+{
+  __m128i a1 = _mm_shuffle_epi8(a, v->rot1);
+  __m128i a23 = _mm_shuffle_epi8(_mm_xor_si128(a, a1), v->rot2);
+
+  return _mm_xor_si128(xvpXtime128(v, _mm_xor_si128(a, a1)),
+		       _mm_xor_si128(a1, a23));
+}
+
+/* InvMixColumn is MixColumn after adding 4 (a[i] + a[i+2]) to row i */
+static inline XSSSE3 __m128i xvpInvMix128(const xvp128 *v, __m128i a)
+{
+  __m128i t = _mm_xor_si128(a, _mm_shuffle_epi8(a, v->rot2));
+
+  t = xvpXtime128(v, xvpXtime128(v, t));
+  return xvpMix128(v, _mm_xor_si128(a, t));
+}
+
+static inline XSSSE3 void xvpShift128(const xvp128 *v, __m128i *lo,
+				      __m128i *hi)
+{
+  __m128i d = _mm_and_si128(_mm_xor_si128(*lo, *hi), v->mask);
+
+  *lo = _mm_shuffle_epi8(_mm_xor_si128(*lo, d), v->perm);
+  *hi = _mm_shuffle_epi8(_mm_xor_si128(*hi, d), v->perm);
+}
+
+/* round key r of block b of the group */
+#define XVPKEY(b, r) (rkk[step * (b)]->rk + 8 * (r))
+
+XSSSE3 void xrijndaelEncryptSSSE3(xword32 block[], int n, roundkey *rkk[],
+				  int step)
+{
+  xvp128 v;
+  __m128i s[2 * XVPGROUP];
+  int m, b, r;
+
+  xvpInit128(&v, 0);
+  for (; n > 0; n -= m, block += 8 * m, rkk += step * m) {
+    m = n < XVPGROUP ? n : XVPGROUP;
+    for (b = 0; b < m; b++) {
+      s[2 * b] = _mm_xor_si128(xvpLoad128(block + 8 * b),
+			       xvpLoad128(XVPKEY(b, 0)));
+      s[2 * b + 1] = _mm_xor_si128(xvpLoad128(block + 8 * b + 4),
+				   xvpLoad128(XVPKEY(b, 0) + 4));
+    }
+    /* the constant of the S-box is added with the round key; it is
+       not changed by MixColumn */
+    for (r = 1; r < 14; r++) {
+      for (b = 0; b < m; b++) {
+	xvpShift128(&v, &s[2 * b], &s[2 * b + 1]);
+	s[2 * b] = _mm_xor_si128(xvpMix128(&v, xvpSub128(&v, s[2 * b])),
+				 _mm_xor_si128(xvpLoad128(XVPKEY(b, r)), v.c63));
+	s[2 * b + 1] = _mm_xor_si128(xvpMix128(&v, xvpSub128(&v, s[2 * b + 1])),
+				     _mm_xor_si128(xvpLoad128(XVPKEY(b, r) + 4), v.c63));
+      }
+    }
+    for (b = 0; b < m; b++) {
+      xvpShift128(&v, &s[2 * b], &s[2 * b + 1]);
+      s[2 * b] = _mm_xor_si128(xvpSub128(&v, s[2 * b]),
+			       _mm_xor_si128(xvpLoad128(XVPKEY(b, 14)), v.c63));
+      s[2 * b + 1] = _mm_xor_si128(xvpSub128(&v, s[2 * b + 1]),
+				   _mm_xor_si128(xvpLoad128(XVPKEY(b, 14) + 4), v.c63));
+      _mm_storeu_si128((__m128i *)(block + 8 * b), s[2 * b]);
+      _mm_storeu_si128((__m128i *)(block + 8 * b + 4), s[2 * b + 1]);
+    }
+  }
+}
+
+XSSSE3 void xrijndaelDecryptSSSE3(xword32 block[], int n, roundkey *rkk[],
+				  int step)
+{
+  xvp128 v;
+  __m128i s[2 * XVPGROUP];
+  int m, b, r;
+
+  xvpInit128(&v, 1);
+  for (; n > 0; n -= m, block += 8 * m, rkk += step * m) {
+    m = n < XVPGROUP ? n : XVPGROUP;
+    for (b = 0; b < m; b++) {
+      s[2 * b] = _mm_xor_si128(xvpLoad128(block + 8 * b),
+			       xvpLoad128(XVPKEY(b, 14)));
+      s[2 * b + 1] = _mm_xor_si128(xvpLoad128(block + 8 * b + 4),
+				   xvpLoad128(XVPKEY(b, 14) + 4));
+      xvpShift128(&v, &s[2 * b], &s[2 * b + 1]);
+      s[2 * b] = xvpSub128(&v, s[2 * b]);
+      s[2 * b + 1] = xvpSub128(&v, s[2 * b + 1]);
+    }
+    for (r = 13; r > 0; r--) {
+      for (b = 0; b < m; b++) {
+	s[2 * b] = xvpInvMix128(&v, _mm_xor_si128(s[2 * b],
+					xvpLoad128(XVPKEY(b, r))));
+	s[2 * b + 1] = xvpInvMix128(&v, _mm_xor_si128(s[2 * b + 1],
+					xvpLoad128(XVPKEY(b, r) + 4)));
+	xvpShift128(&v, &s[2 * b], &s[2 * b + 1]);
+	s[2 * b] = xvpSub128(&v, s[2 * b]);
+	s[2 * b + 1] = xvpSub128(&v, s[2 * b + 1]);
+      }
+    }
+    for (b = 0; b < m; b++) {
+      s[2 * b] = _mm_xor_si128(s[2 * b], xvpLoad128(XVPKEY(b, 0)));
+      s[2 * b + 1] = _mm_xor_si128(s[2 * b + 1], xvpLoad128(XVPKEY(b, 0) + 4));
+      _mm_storeu_si128((__m128i *)(block + 8 * b), s[2 * b]);
+      _mm_storeu_si128((__m128i *)(block + 8 * b + 4), s[2 * b + 1]);
+    }
+  }
+}
+
+/* 256-bit registers: one block per register, and 128-bit tables in
+   both lanes, since vpshufb does not cross lanes */
+
+typedef struct {
+  __m256i in0, in1, inv, ak, out0, out1;
+  __m256i perm, mask, rot1, rot2;
+  __m256i m0f, m1b, c63;
+} xvp256;
+
+static inline XAVX2 __m256i xvpLoad256(const void *p)
+{
+  return _mm256_loadu_si256((const __m256i *)p);
+}
+
+static inline XAVX2 __m256i xvpBroadcast256(const xword8 *p)
+{
+  return _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)p));
+}
+
+static XAVX2 void xvpInit256(xvp256 *v, int dec)
+{
+  v->in0 = xvpBroadcast256(dec ? VPdin[0] : VPin[0]);
+  v->in1 = xvpBroadcast256(dec ? VPdin[1] : VPin[1]);
+  v->inv = xvpBroadcast256(VPinv[0]);
+  v->ak = xvpBroadcast256(VPinv[1]);
+  v->out0 = xvpBroadcast256(dec ? VPdout[0] : VPout[0]);
+  v->out1 = xvpBroadcast256(dec ? VPdout[1] : VPout[1]);
+  v->perm = xvpBroadcast256(xvpPerm[dec]);
+  v->mask = xvpBroadcast256(xvpMask[dec]);
+  v->rot1 = xvpBroadcast256(xvpRot[0]);
+  v->rot2 = xvpBroadcast256(xvpRot[1]);
+  v->m0f = _mm256_set1_epi8(0x0f);
+  v->m1b = _mm256_set1_epi8(0x1b);
+  v->c63 = _mm256_set1_epi8(dec ? 0 : 0x63);
+}
+
+static inline XAVX2 __m256i xvpSub256(const xvp256 *v, __m256i x)
+{
+  __m256i i, j, k, ak, iak, jak, io, jo;
+
+  k = _mm256_and_si256(x, v->m0f);
+  i = _mm256_and_si256(_mm256_srli_epi16(x, 4), v->m0f);
+  x = _mm256_xor_si256(_mm256_shuffle_epi8(v->in0, k),
+		       _mm256_shuffle_epi8(v->in1, i));
+  k = _mm256_and_si256(x, v->m0f);
+  i = _mm256_and_si256(_mm256_srli_epi16(x, 4), v->m0f);
+  j = _mm256_xor_si256(i, k);
+  ak = _mm256_shuffle_epi8(v->ak, k);
+  iak = _mm256_xor_si256(_mm256_shuffle_epi8(v->inv, i), ak);
+  jak = _mm256_xor_si256(_mm256_shuffle_epi8(v->inv, j), ak);
+  io = _mm256_xor_si256(_mm256_shuffle_epi8(v->inv, iak), j);
+  jo = _mm256_xor_si256(_mm256_shuffle_epi8(v->inv, jak), i);
+  return _mm256_xor_si256(_mm256_shuffle_epi8(v->out0, io),
+			  _mm256_shuffle_epi8(v->out1, jo));
+}
+
+static inline XAVX2 __m256i xvpXtime256(const xvp256 *v, __m256i x)
+{
+  __m256i hi = _mm256_cmpgt_epi8(_mm256_setzero_si256(), x);
+
+  return _mm256_xor_si256(_mm256_add_epi8(x, x), _mm256_and_si256(hi, v->m1b));
+}
+
+static inline XAVX2 __m256i xvpMix256(const xvp256 *v, __m256i a)
+{
+  __m256i a1 = _mm256_shuffle_epi8(a, v->rot1);
+  __m256i a23 = _mm256_shuffle_epi8(_mm256_xor_si256(a, a1), v->rot2);
+
+  return _mm256_xor_si256(xvpXtime256(v, _mm256_xor_si256(a, a1)),
+			  _mm256_xor_si256(a1, a23));
+}
+
+static inline XAVX2 __m256i xvpInvMix256(const xvp256 *v, __m256i a)
+{
+  __m256i t = _mm256_xor_si256(a, _mm256_shuffle_epi8(a, v->rot2));
+
+  t = xvpXtime256(v, xvpXtime256(v, t));
+  return xvpMix256(v, _mm256_xor_si256(a, t));
+}
+
+static inline XAVX2 __m256i xvpShift256(const xvp256 *v, __m256i x)
+{
+  __m256i sw = _mm256_permute2x128_si256(x, x, 0x01);
+
+  return _mm256_shuffle_epi8(_mm256_blendv_epi8(x, sw, v->mask), v->perm);
+}
+
+XAVX2 void xrijndaelEncryptAVX2(xword32 block[], int n, roundkey *rkk[],
+				int step)
+{
+  xvp256 v;
+  __m256i s[XVPGROUP];
+  int m, b, r;
+
+  xvpInit256(&v, 0);
+  for (; n > 0; n -= m, block += 8 * m, rkk += step * m) {
+    m = n < XVPGROUP ? n : XVPGROUP;
+    for (b = 0; b < m; b++) {
+      s[b] = _mm256_xor_si256(xvpLoad256(block + 8 * b),
+			      xvpLoad256(XVPKEY(b, 0)));
+    }
+    for (r = 1; r < 14; r++) {
+      for (b = 0; b < m; b++) {
+	s[b] = xvpMix256(&v, xvpSub256(&v, xvpShift256(&v, s[b])));
+	s[b] = _mm256_xor_si256(s[b], _mm256_xor_si256(xvpLoad256(XVPKEY(b, r)),
+						       v.c63));
+      }
+    }
+    for (b = 0; b < m; b++) {
+      s[b] = xvpSub256(&v, xvpShift256(&v, s[b]));
+      s[b] = _mm256_xor_si256(s[b], _mm256_xor_si256(xvpLoad256(XVPKEY(b, 14)),
+						     v.c63));
+      _mm256_storeu_si256((__m256i *)(block + 8 * b), s[b]);
+    }
+  }
+}
+
+XAVX2 void xrijndaelDecryptAVX2(xword32 block[], int n, roundkey *rkk[],
+				int step)
+{
+  xvp256 v;
+  __m256i s[XVPGROUP];
+  int m, b, r;
+
+  xvpInit256(&v, 1);
+  for (; n > 0; n -= m, block += 8 * m, rkk += step * m) {
+    m = n < XVPGROUP ? n : XVPGROUP;
+    for (b = 0; b < m; b++) {
+      s[b] = _mm256_xor_si256(xvpLoad256(block + 8 * b),
+			      xvpLoad256(XVPKEY(b, 14)));
+      s[b] = xvpSub256(&v, xvpShift256(&v, s[b]));
+    }
+    for (r = 13; r > 0; r--) {
+      for (b = 0; b < m; b++) {
+	s[b] = _mm256_xor_si256(s[b], xvpLoad256(XVPKEY(b, r)));
+	s[b] = xvpSub256(&v, xvpShift256(&v, xvpInvMix256(&v, s[b])));
+      }
+    }
+    for (b = 0; b < m; b++) {
+      s[b] = _mm256_xor_si256(s[b], xvpLoad256(XVPKEY(b, 0)));
+      _mm256_storeu_si256((__m256i *)(block + 8 * b), s[b]);
+    }
+  }
+}
+
+#endif				/* XRIJNDAEL_X86 */
@@ -16,12 +16,21 @@ typedef UINT32_TYPE xword32;
 typedef int xword32;		/* should be a 32-bit integer type */
 #endif
 
+typedef unsigned long long xword64;	/* at least 64 bits */
+
 union xword8x4_u {
   xword8 w8[4];
   xword32 w32;
 };
 typedef union xword8x4_u xword8x4;
 
+/* tables are aligned to cache lines */
+#ifdef __GNUC__
+#define XCACHEALIGN __attribute__((aligned(64)))
+#else
+#define XCACHEALIGN
+#endif
+
 #include "tables.h"
 
 #define MAXBC		(256/32)
@@ -29,17 +38,96 @@ typedef union xword8x4_u xword8x4;
 #define MAXROUNDS	14
 #define MAXRK           ((MAXROUNDS+1)*MAXBC)
 
-typedef struct {
+typedef struct roundkey_s roundkey;
+
+/* a single-block kernel, specialized for one block/key geometry */
+typedef void xrijndaelkernel(xword32 block[], roundkey *rkk);
+
+/* a kernel for n blocks; see xrijndaelEncryptBlocks */
+typedef void xrijndaelbatch(xword32 block[], int n, roundkey *rkk[],
+			    int step);
+
+struct roundkey_s {
   int BC;
   int KC;
   int ROUNDS;
   int shift[2][4];
   xword32 rk[MAXRK];
-} roundkey;
+  xword32 drk[MAXRK];		/* decryption keys for the equivalent
+				   inverse cipher, if the kernel uses them */
+  xrijndaelkernel *encrypt;	/* selected once by xrijndaelKeySched */
+  xrijndaelkernel *decrypt;
+};
 
+/* Key schedule for any geometry. Overwrites key with the last KC words
+   of the expanded key. */
 int xrijndaelKeySched(xword32 key[], int keyBits, int blockBits,
 		      roundkey *rkk);
-void xrijndaelEncrypt(xword32 block[], roundkey *rkk);
-void xrijndaelDecrypt(xword32 block[], roundkey *rkk);
+
+/* Key schedule for 256-bit keys and blocks; key is not modified. The
+   last 8 words of the expanded key, which xrijndaelKeySched leaves in
+   key, are rkk->rk[112..119]. xrijndaelKeySched256n is a convenience
+   wrapper that expands n keys one after the other with the selected
+   kernel; interleaving the expansions of several keys measured
+   slower, as out-of-order execution already overlaps them. */
+void xrijndaelKeySched256(const xword32 key[8], roundkey *rkk);
+void xrijndaelKeySched256n(xword32 key[][8], int n, roundkey rkk[]);
+
+/* Name of the kernel used for 256-bit blocks: "aesni", "avx2",
+   "ssse3", "ttable", "compact", "bitsliced" or "generic", followed by
+   "/" and the name of the kernel used by xrijndaelEncryptBlocks and
+   xrijndaelDecryptBlocks if that is another one. They are chosen on
+   first use from the CPU features, or from the environment variable
+   LEANOCRYPT_KERNEL. */
+const char *xrijndaelKernel(void);
+
+/* Encryption and decryption of one block. These call the kernel that
+   xrijndaelKeySched selected for the geometry of rkk. */
+static inline void xrijndaelEncrypt(xword32 block[], roundkey *rkk)
+{
+  rkk->encrypt(block, rkk);
+}
+
+static inline void xrijndaelDecrypt(xword32 block[], roundkey *rkk)
+{
+  rkk->decrypt(block, rkk);
+}
+
+/* Encryption and decryption of n independent blocks, stored one after
+   the other. If step is 0, all blocks use rkk[0]; if step is 1, block
+   i uses rkk[i]. All keys must have the same block size. The kernel
+   may work on several blocks at once to hide latency. */
+void xrijndaelEncryptBlocks(xword32 block[], int n, roundkey *rkk[],
+			    int step);
+void xrijndaelDecryptBlocks(xword32 block[], int n, roundkey *rkk[],
+			    int step);
+
+/* Bitsliced kernel for 256-bit blocks. It uses only logical operations
+   on 64-bit words and no table lookups, so its timing does not depend
+   on the data or the key. It encrypts or decrypts n consecutive
+   blocks of 8 words, XBSLANES at a time. If step is 0, all blocks use
+   rkk[0]; if step is 1, block i uses rkk[i]. All keys must have
+   BC == 8. It is never chosen automatically, since a single block
+   costs as much as a group of XBSLANES; LEANOCRYPT_KERNEL=bitsliced
+   selects it where constant time matters more than speed. */
+#define XBSLANES 8
+
+void xrijndaelEncryptBS(xword32 block[], int n, roundkey *rkk[], int step);
+void xrijndaelDecryptBS(xword32 block[], int n, roundkey *rkk[], int step);
+
+/* Vector-permute kernels for 256-bit blocks, with the same calling
+   convention. They compute SubBytes with pshufb lookups on nibbles,
+   XVPGROUP blocks at a time, using 128-bit (SSSE3) or 256-bit (AVX2)
+   registers. They may only be called if the CPU supports the
+   instructions. */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define XRIJNDAEL_X86
+#define XVPGROUP 8
+
+void xrijndaelEncryptSSSE3(xword32 block[], int n, roundkey *rkk[], int step);
+void xrijndaelDecryptSSSE3(xword32 block[], int n, roundkey *rkk[], int step);
+void xrijndaelEncryptAVX2(xword32 block[], int n, roundkey *rkk[], int step);
+void xrijndaelDecryptAVX2(xword32 block[], int n, roundkey *rkk[], int step);
+#endif
 
 #endif				/* __RIJNDAEL_H */
@@ -6,3 +6,14 @@ extern int xrcon[30];
 extern xword8 xS[256];
 extern xword8 xSi[256];
 
+extern xword8x4 T0[4][256];
+extern xword8x4 T0L[4][256];
+extern xword8x4 T1[4][256];
+extern xword8x4 T1L[4][256];
+extern xword8x4 T0C[256];
+extern xword8x4 T1C[256];
+extern xword8 VPin[2][16];
+extern xword8 VPdin[2][16];
+extern xword8 VPinv[2][16];
+extern xword8 VPout[2][16];
+extern xword8 VPdout[2][16];
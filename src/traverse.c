@@ -327,21 +327,28 @@ static void action_overwrite(char *infile, char *outfile) {
     if (cmd.verbose>0) {
       fprintf(stderr, _("Encrypting %s\n"), infile);
     }
-    r = leanoencrypt_file(fd, cmd.keyword);
+    r = leanoencrypt_file(fd, cmd.key, cmd.chunkshift, cmd.wrapslots, cmd.keyid);
     break;
     
   case DECRYPT:
     if (cmd.verbose>0) {
       fprintf(stderr, _("Decrypting %s\n"), infile);
     }
-    r = leanodencrypt_file(fd, cmd.keyword);
+    r = leanodencrypt_file(fd, cmd.key);
     break;
     
   case KEYCHANGE:
+    if (cmd.addkey) {
+      if (cmd.verbose>0) {
+	fprintf(stderr, _("Adding key for %s\n"), infile);
+      }
+      r = cckeyadd_file(fd, cmd.key, cmd.key2);
+      break;
+    }
     if (cmd.verbose>0) {
       fprintf(stderr, _("Changing key for %s\n"), infile);
     }
-    r = cckeychange_file(fd, cmd.keyword, cmd.keyword2);
+    r = cckeychange_file(fd, cmd.key, cmd.key2, cmd.chunkshift, cmd.wrapslots, cmd.keyid);
     break;
     
   }    
@@ -484,19 +491,19 @@ static void action_tmpfiles(char *infile, char *outfile) {
     if (cmd.verbose>0) {
       fprintf(stderr, _("Encrypting %s\n"), infile);
     }
-    r = leanoencrypt_streams(fin, fout, cmd.keyword);
+    r = leanoencrypt_streams(fin, fout, cmd.key, cmd.chunkshift, cmd.wrapslots, cmd.keyid);
     break;
   case DECRYPT:
     if (cmd.verbose>0) {
       fprintf(stderr, _("Decrypting %s\n"), infile);
     }
-    r = leanodencrypt_streams(fin, fout, cmd.keyword);
+    r = leanodencrypt_streams(fin, fout, cmd.key, cmd.mismatch ? leanocrypt_MISMATCH : 0);
     break;
   case KEYCHANGE:
     if (cmd.verbose>0) {
       fprintf(stderr, _("Changing key for %s\n"), infile);
     }
-    r = cckeychange_streams(fin, fout, cmd.keyword, cmd.keyword2);
+    r = cckeychange_streams(fin, fout, cmd.key, cmd.key2, cmd.chunkshift, cmd.wrapslots, cmd.keyid);
     break;
   }    
   save_errno = errno;
@@ -600,7 +607,7 @@ static void action_cat(char *infile) {
   if (cmd.mode==UNIXCRYPT) {
     r = unixcrypt_streams(fin, stdout, cmd.keyword);
   } else {
-    r = leanodencrypt_streams(fin, stdout, cmd.keyword);
+    r = leanodencrypt_streams(fin, stdout, cmd.key, cmd.mismatch ? leanocrypt_MISMATCH : 0);
   }
   save_errno = errno;
 